@@ -734,6 +734,7 @@ void advanced_inventory::recalc_pane( side p )
     advanced_inventory_pane &pane = panes[p];
     pane.recalc = false;
     pane.items.clear();
+    pane.start_listing();
     advanced_inventory_pane &there = panes[-p + 1];
     advanced_inv_area &other = squares[there.get_area()];
     avatar &player_character = get_avatar();
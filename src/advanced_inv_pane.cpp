@@ -1,10 +1,12 @@
 #include "advanced_inv_pane.h"
 
+#include <algorithm>
 #include <cstddef>
 #include <iterator>
 #include <list>
 #include <memory>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #include "advanced_inv_area.h"
@@ -102,33 +104,38 @@ bool advanced_inventory_pane::is_filtered( const item &it ) const
         return false;
     }
 
-    const std::string str = it.tname();
-    if( filtercache.find( str ) == filtercache.end() ) {
-        const auto filter_fn = item_filter_from_string( filter );
-        filtercache[str] = filter_fn;
-
-        return !filter_fn( it );
+    if( filtered_out.count( &it ) ) {
+        return true;
     }
-
-    return !filtercache[str]( it );
+    if( !filter_func ) {
+        filter_func = item_filter_from_string( filter );
+    }
+    if( !filter_func( it ) ) {
+        filtered_out.insert( &it );
+        return true;
+    }
+    return false;
 }
 
 /** converts a raw list of items to "stacks" - items that are not count_by_charges that otherwise stack go into one stack */
 static std::vector<std::vector<item_location>> item_list_to_stack(
-            const item_location &parent, std::list<item *> item_list )
+            const item_location &parent, const std::list<item *> &item_list )
 {
     std::vector<std::vector<item_location>> ret;
-    for( auto iter_outer = item_list.begin(); iter_outer != item_list.end(); ++iter_outer ) {
-        std::vector<item_location> item_stack( { item_location( parent, *iter_outer ) } );
-        for( auto iter_inner = std::next( iter_outer ); iter_inner != item_list.end(); ) {
-            if( ( *iter_outer )->display_stacked_with( **iter_inner ) ) {
-                item_stack.emplace_back( parent, *iter_inner );
-                iter_inner = item_list.erase( iter_inner );
-            } else {
-                ++iter_inner;
-            }
+    // Stacks that might take an item, by stacking fingerprint, oldest first
+    std::unordered_map<size_t, std::vector<size_t>> candidates;
+    for( item *it : item_list ) {
+        std::vector<size_t> &same_fingerprint = candidates[it->stacking_fingerprint()];
+        const auto stack = std::find_if( same_fingerprint.begin(), same_fingerprint.end(),
+        [&]( size_t idx ) {
+            return ret[idx].front()->display_stacked_with( *it );
+        } );
+        if( stack != same_fingerprint.end() ) {
+            ret[*stack].emplace_back( parent, it );
+        } else {
+            same_fingerprint.push_back( ret.size() );
+            ret.push_back( { item_location( parent, it ) } );
         }
-        ret.push_back( item_stack );
     }
     return ret;
 }
@@ -475,7 +482,16 @@ void advanced_inventory_pane::set_filter( const std::string &new_filter )
     if( filter == new_filter ) {
         return;
     }
+    filter_narrowed = filter_only_narrows( filter, new_filter );
     filter = new_filter;
-    filtercache.clear();
+    filter_func = nullptr;
     recalc = true;
 }
+
+void advanced_inventory_pane::start_listing()
+{
+    if( !filter_narrowed ) {
+        filtered_out.clear();
+    }
+    filter_narrowed = false;
+}
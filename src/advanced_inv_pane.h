@@ -4,8 +4,8 @@
 
 #include <array>
 #include <functional>
-#include <map>
 #include <string>
+#include <unordered_set>
 #include <vector>
 
 #include "advanced_inv_area.h"
@@ -142,10 +142,18 @@ class advanced_inventory_pane
          * Set the filter string, disables filtering when the filter string is empty.
          */
         void set_filter( const std::string &new_filter );
+        /**
+         * Called before the items are listed again. Unless only the filter was narrowed since
+         * the last listing, forgets which items the filter rejected, as they may have changed.
+         */
+        void start_listing();
     private:
         /** Only add offset to index, but wrap around! */
         void mod_index( int offset );
 
-        mutable std::map<std::string, std::function<bool( const item & )>> filtercache;
+        mutable std::function<bool( const item & )> filter_func;
+        // Items rejected by the current filter or a broader one typed before it
+        mutable std::unordered_set<const item *> filtered_out;
+        bool filter_narrowed = false;
 };
 #endif // CATA_SRC_ADVANCED_INV_PANE_H
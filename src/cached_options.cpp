@@ -5,6 +5,9 @@ bool keycode_mode;
 bool log_from_top;
 int message_ttl;
 int message_cooldown;
+bool prefetch_submaps;
+bool speculative_mapgen;
+bool ui_redraw_overlay;
 bool test_mode;
 int prevent_occlusion;
 bool prevent_occlusion_retract;
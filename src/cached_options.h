@@ -15,6 +15,9 @@ extern bool keycode_mode;
 extern bool log_from_top;
 extern int message_ttl;
 extern int message_cooldown;
+extern bool prefetch_submaps;
+extern bool speculative_mapgen;
+extern bool ui_redraw_overlay;
 extern int prevent_occlusion;
 extern bool prevent_occlusion_retract;
 extern bool prevent_occlusion_transp;
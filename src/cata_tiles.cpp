@@ -33,6 +33,7 @@
 #include "filesystem.h"
 #include "game.h"
 #include "game_constants.h"
+#include "hash_utils.h"
 #include "input.h"
 #include "int_id.h"
 #include "item.h"
@@ -50,6 +51,7 @@
 #include "mtype.h"
 #include "mutation.h"
 #include "npc.h"
+#include "options.h"
 #include "output.h"
 #include "overlay_ordering.h"
 #include "overmap.h"
@@ -64,6 +66,7 @@
 #include "string_formatter.h"
 #include "string_id.h"
 #include "submap.h"
+#include "tile_damage.h"
 #include "tileray.h"
 #include "translations.h"
 #include "trap.h"
@@ -85,6 +88,8 @@ static const trait_id trait_INATTENTIVE( "INATTENTIVE" );
 
 static const trap_str_id tr_unfinished_construction( "tr_unfinished_construction" );
 
+static const option_handle<bool> option_NV_GREEN_TOGGLE( "NV_GREEN_TOGGLE" );
+
 static const std::string ITEM_HIGHLIGHT( "highlight_item" );
 static const std::string ZOMBIE_REVIVAL_INDICATOR( "zombie_revival_indicator" );
 
@@ -1276,15 +1281,30 @@ void cata_tiles::draw( const point &dest, const tripoint &center, int width, int
     }
 #endif
 
-    {
-        //set clipping to prevent drawing over stuff we shouldn't
-        SDL_Rect clipRect = {dest.x, dest.y, width, height};
-        printErrorIf( SDL_RenderSetClipRect( renderer.get(), &clipRect ) != 0,
-                      "SDL_RenderSetClipRect failed" );
-
-        //fill render area with black to prevent artifacts where no new pixels are drawn
-        geometry->rect( renderer, clipRect, SDL_Color() );
+    // A partial redraw of the UI limits drawing to the area the UI lost
+    std::optional<SDL_Rect> ui_clip;
+    if( SDL_RenderIsClipEnabled( renderer.get() ) ) {
+        ui_clip = SDL_Rect();
+        SDL_RenderGetClipRect( renderer.get(), &ui_clip.value() );
+    }
+    // The part of `area`, relative to `dest`, that may be drawn to
+    const auto clip_rect = [&]( const half_open_rectangle<point> &area ) {
+        const SDL_Rect rect = { dest.x + area.p_min.x, dest.y + area.p_min.y,
+                                area.p_max.x - area.p_min.x, area.p_max.y - area.p_min.y
+                              };
+        SDL_Rect clipped = rect;
+        if( ui_clip && !SDL_IntersectRect( &rect, &ui_clip.value(), &clipped ) ) {
+            clipped.w = 0;
+            clipped.h = 0;
+        }
+        return clipped;
+    };
+    const half_open_rectangle<point> window_area( point_zero, point( width, height ) );
+    const SDL_Rect window_clip = clip_rect( window_area );
+    if( window_clip.w <= 0 || window_clip.h <= 0 ) {
+        return;
     }
+    drew_animated_tile = false;
 
     const point s = get_window_base_tile_counts( point( width, height ) );
 
@@ -1697,41 +1717,17 @@ void cata_tiles::draw( const point &dest, const tripoint &center, int width, int
         do_draw_shadow = true;
     }
 
-    if( max_draw_depth <= 0 ) {
-        // Legacy draw mode
-        for( int row = min_row; row < max_row; row ++ ) {
-            for( auto f : drawing_layers_legacy ) {
-                for( tile_render_info &p : here.draw_points_cache[center.z][row] ) {
-                    if( const tile_render_info::vision_effect * const
-                        var = std::get_if<tile_render_info::vision_effect>( &p.var ) ) {
-                        if( f == &cata_tiles::draw_terrain ) {
-                            apply_vision_effects( p.com.pos, var->vis, p.com.height_3d );
+    // Draw the tiles in a range of columns and rows
+    const auto draw_tiles = [&]( const half_open_rectangle<point> &tiles ) {
+        if( max_draw_depth <= 0 ) {
+            // Legacy draw mode
+            for( int row = std::max( min_row, tiles.p_min.y ); row < std::min( max_row, tiles.p_max.y );
+                 row ++ ) {
+                for( auto f : drawing_layers_legacy ) {
+                    for( tile_render_info &p : here.draw_points_cache[center.z][row] ) {
+                        if( !tiles.contains( player_to_tile( p.com.pos.xy() ) ) ) {
+                            continue;
                         }
-                    } else if( const tile_render_info::sprite * const
-                               var = std::get_if<tile_render_info::sprite>( &p.var ) ) {
-                        ( this->*f )( p.com.pos, var->ll, p.com.height_3d, var->invisible, false );
-                    }
-                }
-            }
-        }
-    } else {
-        // Multi z-level draw mode
-        // Start drawing from the lowest visible z-level (some off-screen tiles
-        // are considered visible here to simplify the logic.)
-        int cur_zlevel = draw_min_z;
-        while( cur_zlevel <= center.z ) {
-            const half_open_rectangle<point> &cur_any_tile_range = is_isometric()
-                    ? z_any_tile_range[center.z - cur_zlevel] : top_any_tile_range;
-            // For each row
-            for( int row = cur_any_tile_range.p_min.y; row < cur_any_tile_range.p_max.y; row ++ ) {
-                // Set base height for each tile
-                for( tile_render_info &p : here.draw_points_cache[cur_zlevel][row] ) {
-                    p.com.height_3d = ( cur_zlevel - center.z ) * zlevel_height;
-                }
-                // For each layer
-                for( auto f : drawing_layers ) {
-                    // For each tile
-                    for( tile_render_info &p : here.draw_points_cache[cur_zlevel][row] ) {
                         if( const tile_render_info::vision_effect * const
                             var = std::get_if<tile_render_info::vision_effect>( &p.var ) ) {
                             if( f == &cata_tiles::draw_terrain ) {
@@ -1739,38 +1735,163 @@ void cata_tiles::draw( const point &dest, const tripoint &center, int width, int
                             }
                         } else if( const tile_render_info::sprite * const
                                    var = std::get_if<tile_render_info::sprite>( &p.var ) ) {
-
-                            // Get visibility variables
-                            lit_level ll = var->ll;
-                            std::array<bool, 5> invisible = var->invisible;
-
-                            if( f == &cata_tiles::draw_vpart_no_roof || f == &cata_tiles::draw_vpart_roof ) {
-                                int temp_height_3d = p.com.height_3d;
-                                // Reset height_3d to base when drawing vehicles
-                                p.com.height_3d = ( cur_zlevel - center.z ) * zlevel_height;
-                                // Draw
-                                if( !( this->*f )( p.com.pos, ll, p.com.height_3d, invisible, false ) ) {
-                                    // If no vpart drawn, revert height_3d changes
-                                    p.com.height_3d = temp_height_3d;
+                            ( this->*f )( p.com.pos, var->ll, p.com.height_3d, var->invisible, false );
+                        }
+                    }
+                }
+            }
+        } else {
+            // Multi z-level draw mode
+            // Start drawing from the lowest visible z-level (some off-screen tiles
+            // are considered visible here to simplify the logic.)
+            int cur_zlevel = draw_min_z;
+            while( cur_zlevel <= center.z ) {
+                const half_open_rectangle<point> &cur_any_tile_range = is_isometric()
+                        ? z_any_tile_range[center.z - cur_zlevel] : top_any_tile_range;
+                // For each row
+                for( int row = std::max( cur_any_tile_range.p_min.y, tiles.p_min.y );
+                     row < std::min( cur_any_tile_range.p_max.y, tiles.p_max.y ); row ++ ) {
+                    // Set base height for each tile
+                    for( tile_render_info &p : here.draw_points_cache[cur_zlevel][row] ) {
+                        p.com.height_3d = ( cur_zlevel - center.z ) * zlevel_height;
+                    }
+                    // For each layer
+                    for( auto f : drawing_layers ) {
+                        // For each tile
+                        for( tile_render_info &p : here.draw_points_cache[cur_zlevel][row] ) {
+                            if( !tiles.contains( player_to_tile( p.com.pos.xy() ) ) ) {
+                                continue;
+                            }
+                            if( const tile_render_info::vision_effect * const
+                                var = std::get_if<tile_render_info::vision_effect>( &p.var ) ) {
+                                if( f == &cata_tiles::draw_terrain ) {
+                                    apply_vision_effects( p.com.pos, var->vis, p.com.height_3d );
                                 }
-                            } else if( f == &cata_tiles::draw_critter_at ) {
-                                // Draw
-                                if( !( this->*f )( p.com.pos, ll, p.com.height_3d, invisible, false ) && do_draw_shadow &&
-                                    here.dont_draw_lower_floor( p.com.pos ) ) {
-                                    // Draw shadow of flying critters on bottom-most tile if no other critter drawn
-                                    draw_critter_above( p.com.pos, ll, p.com.height_3d, invisible );
+                            } else if( const tile_render_info::sprite * const
+                                       var = std::get_if<tile_render_info::sprite>( &p.var ) ) {
+
+                                // Get visibility variables
+                                lit_level ll = var->ll;
+                                std::array<bool, 5> invisible = var->invisible;
+
+                                if( f == &cata_tiles::draw_vpart_no_roof || f == &cata_tiles::draw_vpart_roof ) {
+                                    int temp_height_3d = p.com.height_3d;
+                                    // Reset height_3d to base when drawing vehicles
+                                    p.com.height_3d = ( cur_zlevel - center.z ) * zlevel_height;
+                                    // Draw
+                                    if( !( this->*f )( p.com.pos, ll, p.com.height_3d, invisible, false ) ) {
+                                        // If no vpart drawn, revert height_3d changes
+                                        p.com.height_3d = temp_height_3d;
+                                    }
+                                } else if( f == &cata_tiles::draw_critter_at ) {
+                                    // Draw
+                                    if( !( this->*f )( p.com.pos, ll, p.com.height_3d, invisible, false ) && do_draw_shadow &&
+                                        here.dont_draw_lower_floor( p.com.pos ) ) {
+                                        // Draw shadow of flying critters on bottom-most tile if no other critter drawn
+                                        draw_critter_above( p.com.pos, ll, p.com.height_3d, invisible );
+                                    }
+                                } else {
+                                    // Draw
+                                    ( this->*f )( p.com.pos, ll, p.com.height_3d, invisible, false );
                                 }
-                            } else {
-                                // Draw
-                                ( this->*f )( p.com.pos, ll, p.com.height_3d, invisible, false );
                             }
                         }
                     }
                 }
+                cur_zlevel += 1;
             }
-            cur_zlevel += 1;
+        }
+    };
+
+    // The pixels of the window to repaint, relative to `dest`. Unless the
+    // window lost them, the pixels of tiles that look the same as in the last
+    // frame are kept.
+    const point tile_size( tile_width, tile_height );
+    // Sprites are drawn higher than their extent on furniture with `height_3d`
+    const half_open_rectangle<point> sprite_extent( max_tile_extent.p_min - point( 0, tile_height ),
+            max_tile_extent.p_max );
+    const frame_key key{ dest, point( width, height ), o, center.z, tile_size, nv_goggles_activated,
+                         static_cast<int>( season_of_year( calendar::turn ) ), tileset_ptr.get() };
+    std::vector<half_open_rectangle<point>> repaint;
+    const bool has_overrides = !radiation_override.empty() || !terrain_override.empty() ||
+                               !furniture_override.empty() || !graffiti_override.empty() ||
+                               !trap_override.empty() || !field_override.empty() ||
+                               !item_override.empty() || !vpart_override.empty() ||
+                               !draw_below_override.empty() || !monster_override.empty();
+    if( ui_clip ) {
+        // Only the area lost by the UI is repainted, which the tiles no longer match
+        repaint.emplace_back( point( ui_clip->x, ui_clip->y ) - dest,
+                              point( ui_clip->x + ui_clip->w, ui_clip->y + ui_clip->h ) - dest );
+        drawn_tiles.reset();
+    } else if( is_isometric() || zlevel_height != 0 || has_overrides ) {
+        repaint.push_back( window_area );
+        drawn_tiles.reset();
+    } else {
+        const point frame_size( max_col - min_col, max_row - min_row );
+        std::vector<std::size_t> fingerprints( static_cast<std::size_t>( frame_size.x * frame_size.y ) );
+        for( int zlevel = draw_min_z; zlevel <= center.z; zlevel++ ) {
+            for( int row = min_row; row < max_row; row++ ) {
+                for( const tile_render_info &p : here.draw_points_cache[zlevel][row] ) {
+                    const point tile = player_to_tile( p.com.pos.xy() ) - point( min_col, min_row );
+                    if( tile.x < 0 || tile.y < 0 || tile.x >= frame_size.x || tile.y >= frame_size.y ) {
+                        continue;
+                    }
+                    std::size_t &fingerprint = fingerprints[tile.y * frame_size.x + tile.x];
+                    cata::hash_combine( fingerprint, zlevel );
+                    if( const tile_render_info::vision_effect * const
+                        var = std::get_if<tile_render_info::vision_effect>( &p.var ) ) {
+                        cata::hash_combine( fingerprint, static_cast<int>( var->vis ) );
+                    } else if( const tile_render_info::sprite * const
+                               var = std::get_if<tile_render_info::sprite>( &p.var ) ) {
+                        cata::hash_combine( fingerprint, static_cast<int>( var->ll ) );
+                        for( const bool invisible : var->invisible ) {
+                            cata::hash_combine( fingerprint, invisible );
+                        }
+                        if( !var->invisible[0] ) {
+                            cata::hash_combine( fingerprint,
+                                                tile_contents_fingerprint( here, tripoint_bub_ms( p.com.pos ) ) );
+                        }
+                    }
+                }
+            }
+        }
+        if( !last_frame_reusable || key != last_frame_key ) {
+            drawn_tiles.reset();
+        }
+        for( const half_open_rectangle<point> &tiles :
+             drawn_tiles.update( frame_size, std::move( fingerprints ) ) ) {
+            // Sprites connect to their neighbours, which then change too
+            const half_open_rectangle<point> grown( tiles.p_min + point( min_col - 1, min_row - 1 ),
+                                                    tiles.p_max + point( min_col + 1, min_row + 1 ) );
+            repaint.push_back( tile_sprite_area( grown, tile_size, sprite_extent ) );
+        }
+        if( lost_area ) {
+            repaint.emplace_back( lost_area->p_min - dest, lost_area->p_max - dest );
+        }
+    }
+    lost_area.reset();
+    last_frame_key = key;
+
+    for( const half_open_rectangle<point> &area : repaint ) {
+        const SDL_Rect clipRect = clip_rect( area );
+        if( clipRect.w <= 0 || clipRect.h <= 0 ) {
+            continue;
+        }
+        //set clipping to prevent drawing over stuff we shouldn't
+        printErrorIf( SDL_RenderSetClipRect( renderer.get(), &clipRect ) != 0,
+                      "SDL_RenderSetClipRect failed" );
+        //fill render area with black to prevent artifacts where no new pixels are drawn
+        geometry->rect( renderer, clipRect, SDL_Color() );
+        if( is_isometric() ) {
+            draw_tiles( half_open_rectangle<point>( point( min_col, min_row ), point( max_col, max_row ) ) );
+        } else {
+            const half_open_rectangle<point> clipped( point( clipRect.x, clipRect.y ) - dest,
+                    point( clipRect.x + clipRect.w, clipRect.y + clipRect.h ) - dest );
+            draw_tiles( tiles_covering( clipped, tile_size, sprite_extent ) );
         }
     }
+    printErrorIf( SDL_RenderSetClipRect( renderer.get(), &window_clip ) != 0,
+                  "SDL_RenderSetClipRect failed" );
 
     // display number of monsters to spawn in mapgen preview
     for( int row = top_any_tile_range.p_min.y; row < top_any_tile_range.p_max.y; row ++ ) {
@@ -1853,6 +1974,10 @@ void cata_tiles::draw( const point &dest, const tripoint &center, int width, int
                    do_draw_sct || do_draw_zones || do_draw_async_anim;
 
     draw_footsteps_frame( center );
+    // Anything drawn over the tiles has to be painted over in the next frame
+    last_frame_reusable = !in_animation && !drew_animated_tile && overlay_strings.empty() &&
+                          color_blocks.second.empty() && sounds::get_footstep_markers().empty() &&
+                          !g->is_zones_manager_open();
     if( in_animation ) {
         if( do_draw_explosion ) {
             draw_explosion_frame();
@@ -1899,10 +2024,12 @@ void cata_tiles::draw( const point &dest, const tripoint &center, int width, int
         draw_from_id_string( "cursor", TILE_CATEGORY::NONE, empty_string,
                              tripoint( g->ter_view_p.xy(), center.z ), 0, 0, lit_level::LIT,
                              false );
+        last_frame_reusable = false;
     }
     if( you.controlling_vehicle ) {
         std::optional<tripoint> indicator_offset = g->get_veh_dir_indicator_location( true );
         if( indicator_offset ) {
+            last_frame_reusable = false;
             draw_from_id_string( "cursor", TILE_CATEGORY::NONE, empty_string,
                                  indicator_offset->xy() +
                                  tripoint( you.posx(), you.posy(), center.z ),
@@ -1910,10 +2037,15 @@ void cata_tiles::draw( const point &dest, const tripoint &center, int width, int
         }
     }
 
-    printErrorIf( SDL_RenderSetClipRect( renderer.get(), nullptr ) != 0,
+    printErrorIf( SDL_RenderSetClipRect( renderer.get(), ui_clip ? &ui_clip.value() : nullptr ) != 0,
                   "SDL_RenderSetClipRect failed" );
 }
 
+void cata_tiles::set_lost_area( const std::optional<rectangle<point>> &area )
+{
+    lost_area = area;
+}
+
 void cata_tiles::set_draw_cache_dirty()
 {
     get_map().draw_points_cache_dirty = true;
@@ -2489,7 +2621,7 @@ bool cata_tiles::draw_from_id_string_internal( const std::string &id, TILE_CATEG
         int intensity_level, const std::string &variant,
         const point &offset )
 {
-    bool nv_color_active = apply_night_vision_goggles && get_option<bool>( "NV_GREEN_TOGGLE" );
+    bool nv_color_active = apply_night_vision_goggles && option_NV_GREEN_TOGGLE.get();
     // If the ID string does not produce a drawable tile
     // it will revert to the "unknown" tile.
     // The "unknown" tile is one that is highly visible so you kinda can't miss it :D
@@ -2904,6 +3036,7 @@ bool cata_tiles::draw_from_id_string_internal( const std::string &id, TILE_CATEG
 
         // idle tile animations:
         if( display_tile.animated ) {
+            drew_animated_tile = true;
             // idle animations run during the user's turn, and the animation speed
             // needs to be defined by the tileset to look good, so we use system clock:
             std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
@@ -5,6 +5,7 @@
 #include <cstddef>
 #include <map>
 #include <memory>
+#include <optional>
 #include <string>
 #include <tuple>
 #include <unordered_map>
@@ -25,6 +26,7 @@
 #include "point.h"
 #include "sdl_wrappers.h"
 #include "sdl_geometry.h"
+#include "tile_damage.h"
 #include "type_id.h"
 #include "weather.h"
 #include "weighted_list.h"
@@ -840,9 +842,27 @@ class cata_tiles
 
         pimpl<pixel_minimap> minimap;
 
+        // Everything besides the map tiles that the look of a frame depends on:
+        // position, size, view offset, z-level, tile size, night vision, season
+        // and tileset.
+        using frame_key = std::tuple<point, point, point, int, point, bool, int, const tileset *>;
+        frame_key last_frame_key;
+        // What the map tiles looked like in the last frame
+        tile_damage_tracker drawn_tiles;
+        // Whether the last frame only showed map tiles, so its pixels can be kept
+        bool last_frame_reusable = false;
+        bool drew_animated_tile = false;
+        // See `set_lost_area`
+        std::optional<rectangle<point>> lost_area;
+
     public:
         // Draw caches persist data between draws and are only recalculated when dirty
         void set_draw_cache_dirty();
+        /**
+         * Pixels of the terrain window lost since the last draw, which the next
+         * draw repaints even where the map tiles look the same.
+         */
+        void set_lost_area( const std::optional<rectangle<point>> &area );
 
         std::string memory_map_mode = "color_pixel_sepia";
 };
@@ -680,6 +680,7 @@ item_location Character::get_wielded_item()
 void Character::set_wielded_item( const item &to_wield )
 {
     weapon = to_wield;
+    visibility_revision++;
 }
 
 std::vector<matype_id> Character::known_styles( bool teachable_only ) const
@@ -7652,6 +7653,7 @@ void Character::recalculate_bodyparts()
 
 void Character::recalculate_enchantment_cache()
 {
+    visibility_revision++;
     // start by resetting the cache to all inventory items
     *enchantment_cache = inv->get_active_enchantment_cache( *this );
 
@@ -7668,38 +7670,53 @@ void Character::recalculate_enchantment_cache()
         }
     } );
 
-    // get from traits/ mutations
-    for( const std::pair<const trait_id, trait_data> &mut_map : my_mutations ) {
-        const mutation_branch &mut = mut_map.first.obj();
-
-        for( const enchantment_id &ench_id : mut.enchantments ) {
-            const enchantment &ench = ench_id.obj();
-            if( ench.is_active( *this, mut.activated && mut_map.second.powered ) ) {
+    enchantment_cache_counters &counters = get_enchantment_cache_counters();
+    counters.recalculations++;
+    // Mutations, bionics and effects rarely change between turns, so the enchantments they grant
+    // are only looked up again when the sources or their active state changed. Enchantments with
+    // a dialog condition are kept and checked every time, as the condition can change any turn.
+    const auto add_entries = [this, &counters]( const auto & cache, bool rebuilt ) {
+        ( rebuilt ? counters.source_rebuilds : counters.source_reuses )++;
+        for( const std::pair<enchantment_id, bool> &entry : cache.entries ) {
+            const enchantment &ench = entry.first.obj();
+            if( !entry.second || ench.is_active( *this, false ) ) {
                 enchantment_cache->force_add( ench, *this );
             }
         }
+    };
+
+    // get from traits/ mutations
+    std::vector<std::pair<trait_id, bool>> current_mutations;
+    current_mutations.reserve( my_mutations.size() );
+    for( const std::pair<const trait_id, trait_data> &mut_map : my_mutations ) {
+        current_mutations.emplace_back( mut_map.first,
+                                        mut_map.first->activated && mut_map.second.powered );
     }
+    add_entries( mutation_enchantments, mutation_enchantments.update( *this,
+    std::move( current_mutations ), []( const trait_id & mut ) -> const std::vector<enchantment_id> & {
+        return mut->enchantments;
+    } ) );
 
+    std::vector<std::pair<bionic_id, bool>> current_bionics;
+    current_bionics.reserve( my_bionics->size() );
     for( const bionic &bio : *my_bionics ) {
-        const bionic_id &bid = bio.id;
-
-        for( const enchantment_id &ench_id : bid->enchantments ) {
-            const enchantment &ench = ench_id.obj();
-            if( ench.is_active( *this, bio.powered &&
-                                bid->has_flag( STATIC( json_character_flag( "BIONIC_TOGGLED" ) ) ) ) ) {
-                enchantment_cache->force_add( ench, *this );
-            }
-        }
+        current_bionics.emplace_back( bio.id, bio.powered &&
+                                      bio.id->has_flag( STATIC( json_character_flag( "BIONIC_TOGGLED" ) ) ) );
     }
+    add_entries( bionic_enchantments, bionic_enchantments.update( *this,
+    std::move( current_bionics ), []( const bionic_id & bid ) -> const std::vector<enchantment_id> & {
+        return bid->enchantments;
+    } ) );
 
+    std::vector<std::pair<efftype_id, bool>> current_effects;
+    current_effects.reserve( effects->size() );
     for( const auto &elem : *effects ) {
-        for( const enchantment_id &ench_id : elem.first->enchantments ) {
-            const enchantment &ench = ench_id.obj();
-            if( ench.is_active( *this, true ) ) {
-                enchantment_cache->force_add( ench, *this );
-            }
-        }
+        current_effects.emplace_back( elem.first, true );
     }
+    add_entries( effect_enchantments, effect_enchantments.update( *this,
+    std::move( current_effects ), []( const efftype_id & eff ) -> const std::vector<enchantment_id> & {
+        return eff->enchantments;
+    } ) );
 
     if( enchantment_cache->modifies_bodyparts() ) {
         recalculate_bodyparts();
@@ -7707,6 +7724,12 @@ void Character::recalculate_enchantment_cache()
     recalc_hp();
 }
 
+Character::enchantment_cache_counters &Character::get_enchantment_cache_counters()
+{
+    static enchantment_cache_counters counters;
+    return counters;
+}
+
 double Character::calculate_by_enchantment( double modify, enchant_vals::mod value,
         bool round_output ) const
 {
@@ -9804,6 +9827,7 @@ void Character::on_worn_item_washed( const item &it )
 
 void Character::on_item_wear( const item &it )
 {
+    visibility_revision++;
     invalidate_inventory_validity_cache();
     invalidate_leak_level_cache();
     for( const trait_id &mut : it.mutations_from_wearing( *this ) ) {
@@ -9817,6 +9841,7 @@ void Character::on_item_wear( const item &it )
 
 void Character::on_item_takeoff( const item &it )
 {
+    visibility_revision++;
     invalidate_inventory_validity_cache();
     invalidate_weight_carried_cache();
     invalidate_leak_level_cache();
@@ -9874,6 +9899,7 @@ void Character::on_effect_int_change( const efftype_id &eid, int intensity,
 
 void Character::on_mutation_gain( const trait_id &mid )
 {
+    visibility_revision++;
     morale->on_mutation_gain( mid );
     magic->on_mutation_gain( mid, *this );
     update_type_of_scent( mid );
@@ -9886,6 +9912,7 @@ void Character::on_mutation_gain( const trait_id &mid )
 
 void Character::on_mutation_loss( const trait_id &mid )
 {
+    visibility_revision++;
     morale->on_mutation_loss( mid );
     magic->on_mutation_loss( mid );
     update_type_of_scent( mid, false );
@@ -12672,6 +12699,7 @@ int Character::hp_percentage() const
 
 void Character::on_worn_item_transform( const item &old_it, const item &new_it )
 {
+    visibility_revision++;
     morale->on_worn_item_transform( old_it, new_it );
 }
 
@@ -36,6 +36,7 @@
 #include "creature.h"
 #include "damage.h"
 #include "enums.h"
+#include "flat_id_map.h"
 #include "flat_set.h"
 #include "game_constants.h"
 #include "inventory.h"
@@ -3721,7 +3722,7 @@ class Character : public Creature, public visitable
         /** Signify that leak_level needs refreshing. Set to true on inventory change. */
         bool leak_level_dirty = true;
         // Cache if current bionic layout has certain json flag. Refreshed upon bionics add/remove, activation/deactivation.
-        mutable std::map<const json_character_flag, bool> bio_flag_cache;
+        mutable cata::flat_id_map<json_character_flag, bool> bio_flag_cache;
     public:
         float get_leak_level() const;
         /** Iterate through the character inventory to get its leak level */
@@ -4159,7 +4160,21 @@ class Character : public Creature, public visitable
         // is recalculated every turn in Character::recalculate_enchantment_cache
         pimpl<enchant_cache> enchantment_cache;
 
+        struct enchantment_cache_counters {
+            int recalculations = 0;
+            // times the enchantments of mutations, bionics or effects had to be collected again
+            int source_rebuilds = 0;
+            int source_reuses = 0;
+        };
+        /** Counters of Character::recalculate_enchantment_cache, shared by all characters. */
+        static enchantment_cache_counters &get_enchantment_cache_counters();
+
     private:
+        // Enchantments of mutations, bionics and effects, collected again only when those change.
+        enchantment_source_cache<trait_id> mutation_enchantments; // NOLINT(cata-serialize)
+        enchantment_source_cache<bionic_id> bionic_enchantments; // NOLINT(cata-serialize)
+        enchantment_source_cache<efftype_id> effect_enchantments; // NOLINT(cata-serialize)
+
         /* cached recipes, which are invalidated if the turn changes */
         mutable time_point cached_recipe_turn;
         pimpl<recipe_subset> cached_recipe_subset;
@@ -109,6 +109,8 @@ void zone_manager::clear()
     // Do not clear types since it is needed for the next games.
     area_cache.clear();
     vzone_cache.clear();
+    area_bounds.clear();
+    vzone_bounds.clear();
 }
 
 std::string zone_type::name() const
@@ -856,9 +858,44 @@ bool zone_manager::has_defined( const zone_type_id &type, const faction_id &fac
     return type_iter != area_cache.end();
 }
 
+namespace
+{
+int square_dist_to( const inclusive_cuboid<tripoint_abs_ms> &box, const tripoint_abs_ms &p )
+{
+    return square_dist( clamp( p, box ), p );
+}
+
+// Calls func for every point of box that lies within range of where, optionally restricted
+// to the z-level of where (vehicle zones are only searched on the current level).
+template<typename F>
+void for_each_in_range( const inclusive_cuboid<tripoint_abs_ms> &box,
+                        const tripoint_abs_ms &where, int range, bool same_z, F &&func )
+{
+    const tripoint_abs_ms lo( std::max( box.p_min.x(), where.x() - range ),
+                              std::max( box.p_min.y(), where.y() - range ),
+                              same_z ? where.z() : std::max( box.p_min.z(), where.z() - range ) );
+    const tripoint_abs_ms hi( std::min( box.p_max.x(), where.x() + range ),
+                              std::min( box.p_max.y(), where.y() + range ),
+                              same_z ? where.z() : std::min( box.p_max.z(), where.z() + range ) );
+    if( lo.x() > hi.x() || lo.y() > hi.y() || lo.z() > hi.z() ||
+        lo.z() < box.p_min.z() || hi.z() > box.p_max.z() ) {
+        return;
+    }
+    for( const tripoint_abs_ms &p : tripoint_range<tripoint_abs_ms>( lo, hi ) ) {
+        func( p );
+    }
+}
+
+bool is_loot_type( const std::string &type_hash )
+{
+    return type_hash.compare( 0, 4, "LOOT" ) == 0;
+}
+} // namespace
+
 void zone_manager::cache_data( bool update_avatar )
 {
     area_cache.clear();
+    area_bounds.clear();
     avatar &player_character = get_avatar();
     tripoint_abs_ms cached_shift = player_character.get_location();
     for( zone_data &elem : zones ) {
@@ -874,6 +911,7 @@ void zone_manager::cache_data( bool update_avatar )
 
         const std::string &type_hash = elem.get_type_hash();
         auto &cache = area_cache[type_hash];
+        area_bounds[type_hash].emplace_back( elem.get_start_point(), elem.get_end_point() );
 
         // Draw marked area
         for( const tripoint_abs_ms &p : tripoint_range<tripoint_abs_ms>(
@@ -914,6 +952,7 @@ void zone_manager::cache_avatar_location()
 void zone_manager::cache_vzones( map *pmap )
 {
     vzone_cache.clear();
+    vzone_bounds.clear();
     map &here = pmap == nullptr ? get_map() : *pmap;
     auto vzones = here.get_vehicle_zones( here.get_abs_sub().z() );
     for( zone_data *elem : vzones ) {
@@ -923,6 +962,7 @@ void zone_manager::cache_vzones( map *pmap )
 
         const std::string &type_hash = elem->get_type_hash();
         auto &cache = vzone_cache[type_hash];
+        vzone_bounds[type_hash].emplace_back( elem->get_start_point(), elem->get_end_point() );
 
         // TODO: looks very similar to the above cache_data - maybe merge it?
 
@@ -934,12 +974,26 @@ void zone_manager::cache_vzones( map *pmap )
     }
 }
 
-std::unordered_set<tripoint_abs_ms> zone_manager::get_point_set( const zone_type_id &type,
+const std::unordered_set<tripoint_abs_ms> &zone_manager::get_point_set( const zone_type_id &type,
         const faction_id &fac ) const
 {
+    static const std::unordered_set<tripoint_abs_ms> empty;
     const auto &type_iter = area_cache.find( zone_data::make_type_hash( type, fac ) );
     if( type_iter == area_cache.end() ) {
-        return std::unordered_set<tripoint_abs_ms>();
+        return empty;
+    }
+
+    return type_iter->second;
+}
+
+const std::vector<inclusive_cuboid<tripoint_abs_ms>> &zone_manager::get_bounds(
+            const zone_type_id &type, const faction_id &fac, bool vehicle ) const
+{
+    static const std::vector<inclusive_cuboid<tripoint_abs_ms>> empty;
+    const auto &bounds = vehicle ? vzone_bounds : area_bounds;
+    const auto &type_iter = bounds.find( zone_data::make_type_hash( type, fac ) );
+    if( type_iter == bounds.end() ) {
+        return empty;
     }
 
     return type_iter->second;
@@ -956,34 +1010,28 @@ std::unordered_set<tripoint> zone_manager::get_point_set_loot( const tripoint_ab
 {
     std::unordered_set<tripoint> res;
     map &here = get_map();
-    for( const std::pair<std::string, std::unordered_set<tripoint_abs_ms>> cache : area_cache ) {
-        zone_type_id type = zone_data::unhash_type( cache.first );
-        faction_id z_fac = zone_data::unhash_fac( cache.first );
-        if( fac == z_fac && type.str().substr( 0, 4 ) == "LOOT" ) {
-            for( tripoint_abs_ms point : cache.second ) {
-                if( square_dist( where, point ) <= radius ) {
-                    res.emplace( here.getlocal( point ) );
-                }
+    const auto add_point = [&res, &here]( const tripoint_abs_ms & point ) {
+        res.emplace( here.getlocal( point ) );
+    };
+    for( const auto &bounds : area_bounds ) {
+        if( is_loot_type( bounds.first ) && fac == zone_data::unhash_fac( bounds.first ) ) {
+            for( const inclusive_cuboid<tripoint_abs_ms> &box : bounds.second ) {
+                for_each_in_range( box, where, radius, false, add_point );
             }
         }
     }
-    for( const std::pair<std::string, std::unordered_set<tripoint_abs_ms>> cache : vzone_cache ) {
-        zone_type_id type = zone_data::unhash_type( cache.first );
-        faction_id z_fac = zone_data::unhash_fac( cache.first );
-        if( fac == z_fac && type.str().substr( 0, 4 ) == "LOOT" ) {
-            for( tripoint_abs_ms point : cache.second ) {
-                if( square_dist( where, point ) <= radius ) {
-                    res.emplace( here.getlocal( point ) );
-                }
+    for( const auto &bounds : vzone_bounds ) {
+        if( is_loot_type( bounds.first ) && fac == zone_data::unhash_fac( bounds.first ) ) {
+            for( const inclusive_cuboid<tripoint_abs_ms> &box : bounds.second ) {
+                for_each_in_range( box, where, radius, false, add_point );
             }
         }
     }
 
     if( npc_search ) {
-        for( const std::pair<std::string, std::unordered_set<tripoint_abs_ms>> cache : vzone_cache ) {
-            zone_type_id type = zone_data::unhash_type( cache.first );
-            if( type == zone_type_NO_NPC_PICKUP ) {
-                for( tripoint_abs_ms point : cache.second ) {
+        for( const auto &cache : vzone_cache ) {
+            if( zone_data::unhash_type( cache.first ) == zone_type_NO_NPC_PICKUP ) {
+                for( const tripoint_abs_ms &point : cache.second ) {
                     res.erase( here.getlocal( point ) );
                 }
             }
@@ -993,13 +1041,14 @@ std::unordered_set<tripoint> zone_manager::get_point_set_loot( const tripoint_ab
     return res;
 }
 
-std::unordered_set<tripoint_abs_ms> zone_manager::get_vzone_set( const zone_type_id &type,
+const std::unordered_set<tripoint_abs_ms> &zone_manager::get_vzone_set( const zone_type_id &type,
         const faction_id &fac ) const
 {
+    static const std::unordered_set<tripoint_abs_ms> empty;
     //Only regenerate the vehicle zone cache if any vehicles have moved
     const auto &type_iter = vzone_cache.find( zone_data::make_type_hash( type, fac ) );
     if( type_iter == vzone_cache.end() ) {
-        return std::unordered_set<tripoint_abs_ms>();
+        return empty;
     }
 
     return type_iter->second;
@@ -1016,19 +1065,16 @@ bool zone_manager::has( const zone_type_id &type, const tripoint_abs_ms &where,
 bool zone_manager::has_near( const zone_type_id &type, const tripoint_abs_ms &where, int range,
                              const faction_id &fac ) const
 {
-    const auto &point_set = get_point_set( type, fac );
-    for( const tripoint_abs_ms &point : point_set ) {
-        if( square_dist( point, where ) <= range ) {
+    for( const inclusive_cuboid<tripoint_abs_ms> &box : get_bounds( type, fac, false ) ) {
+        if( square_dist_to( box, where ) <= range ) {
             return true;
         }
     }
 
-    const auto &vzone_set = get_vzone_set( type, fac );
-    for( const tripoint_abs_ms &point : vzone_set ) {
-        if( point.z() == where.z() ) {
-            if( square_dist( point, where ) <= range ) {
-                return true;
-            }
+    for( const inclusive_cuboid<tripoint_abs_ms> &box : get_bounds( type, fac, true ) ) {
+        if( box.p_min.z() <= where.z() && where.z() <= box.p_max.z() &&
+            square_dist_to( box, where ) <= range ) {
+            return true;
         }
     }
 
@@ -1139,28 +1185,26 @@ bool zone_manager::custom_loot_has( const tripoint_abs_ms &where, const item *it
 std::unordered_set<tripoint_abs_ms> zone_manager::get_near( const zone_type_id &type,
         const tripoint_abs_ms &where, int range, const item *it, const faction_id &fac ) const
 {
-    const auto &point_set = get_point_set( type, fac );
     std::unordered_set<tripoint_abs_ms> near_point_set;
-
-    for( const tripoint_abs_ms &point : point_set ) {
-        if( square_dist( point, where ) <= range ) {
-            if( ( type != zone_type_LOOT_CUSTOM && type != zone_type_LOOT_ITEM_GROUP ) ||
-                ( it != nullptr && custom_loot_has( point, it, type, fac ) ) ) {
-                near_point_set.insert( point );
-            }
-        }
+    const bool filtered = type == zone_type_LOOT_CUSTOM || type == zone_type_LOOT_ITEM_GROUP;
+    if( filtered && it == nullptr ) {
+        return near_point_set;
     }
-
-    const auto &vzone_set = get_vzone_set( type, fac );
-    for( const tripoint_abs_ms &point : vzone_set ) {
-        if( point.z() == where.z() ) {
-            if( square_dist( point, where ) <= range ) {
-                if( ( type != zone_type_LOOT_CUSTOM && type != zone_type_LOOT_ITEM_GROUP ) ||
-                    ( it != nullptr && custom_loot_has( point, it, type, fac ) ) ) {
-                    near_point_set.insert( point );
-                }
-            }
+    // Overlapping zones share tiles, so skip ones already accepted before running the filter
+    const auto add_point = [&]( const tripoint_abs_ms & point ) {
+        if( near_point_set.count( point ) != 0 ) {
+            return;
+        }
+        if( !filtered || custom_loot_has( point, it, type, fac ) ) {
+            near_point_set.insert( point );
         }
+    };
+
+    for( const inclusive_cuboid<tripoint_abs_ms> &box : get_bounds( type, fac, false ) ) {
+        for_each_in_range( box, where, range, false, add_point );
+    }
+    for( const inclusive_cuboid<tripoint_abs_ms> &box : get_bounds( type, fac, true ) ) {
+        for_each_in_range( box, where, range, true, add_point );
     }
 
     return near_point_set;
@@ -1175,8 +1219,9 @@ std::optional<tripoint_abs_ms> zone_manager::get_nearest( const zone_type_id &ty
 
     tripoint_abs_ms nearest_pos( INT_MIN, INT_MIN, INT_MIN );
     int nearest_dist = range + 1;
-    const std::unordered_set<tripoint_abs_ms> &point_set = get_point_set( type, fac );
-    for( const tripoint_abs_ms &p : point_set ) {
+    // The closest point of each zone is its bounding box clamped towards where
+    for( const inclusive_cuboid<tripoint_abs_ms> &box : get_bounds( type, fac, false ) ) {
+        const tripoint_abs_ms p = clamp( where, box );
         int cur_dist = square_dist( p, where );
         if( cur_dist < nearest_dist ) {
             nearest_dist = cur_dist;
@@ -1187,8 +1232,8 @@ std::optional<tripoint_abs_ms> zone_manager::get_nearest( const zone_type_id &ty
         }
     }
 
-    const std::unordered_set<tripoint_abs_ms> &vzone_set = get_vzone_set( type, fac );
-    for( const tripoint_abs_ms &p : vzone_set ) {
+    for( const inclusive_cuboid<tripoint_abs_ms> &box : get_bounds( type, fac, true ) ) {
+        const tripoint_abs_ms p = clamp( where, box );
         int cur_dist = square_dist( p, where );
         if( cur_dist < nearest_dist ) {
             nearest_dist = cur_dist;
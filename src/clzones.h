@@ -537,10 +537,19 @@ class zone_manager
         std::unordered_map<std::string, std::unordered_set<tripoint_abs_ms>> area_cache;
         // NOLINTNEXTLINE(cata-serialize)
         std::unordered_map<std::string, std::unordered_set<tripoint_abs_ms>> vzone_cache;
-        std::unordered_set<tripoint_abs_ms> get_point_set( const zone_type_id &type,
+        // Bounding boxes of the enabled zones behind area_cache / vzone_cache, keyed by the
+        // same type hash. Range queries walk these instead of every cached point, so they
+        // only touch the tiles that are actually inside the requested range.
+        // NOLINTNEXTLINE(cata-serialize)
+        std::unordered_map<std::string, std::vector<inclusive_cuboid<tripoint_abs_ms>>> area_bounds;
+        // NOLINTNEXTLINE(cata-serialize)
+        std::unordered_map<std::string, std::vector<inclusive_cuboid<tripoint_abs_ms>>> vzone_bounds;
+        const std::unordered_set<tripoint_abs_ms> &get_point_set( const zone_type_id &type,
                 const faction_id &fac = your_fac ) const;
-        std::unordered_set<tripoint_abs_ms> get_vzone_set( const zone_type_id &type,
+        const std::unordered_set<tripoint_abs_ms> &get_vzone_set( const zone_type_id &type,
                 const faction_id &fac = your_fac ) const;
+        const std::vector<inclusive_cuboid<tripoint_abs_ms>> &get_bounds( const zone_type_id &type,
+                const faction_id &fac, bool vehicle ) const;
     public:
         zone_manager();
         ~zone_manager() = default;
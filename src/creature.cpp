@@ -3,6 +3,7 @@
 #include <algorithm>
 #include <array>
 #include <cmath>
+#include <cstdint>
 #include <cstdlib>
 #include <functional>
 #include <map>
@@ -24,6 +25,7 @@
 #include "character_id.h"
 #include "color.h"
 #include "creature_tracker.h"
+#include "creature_visibility.h"
 #include "cursesdef.h"
 #include "damage.h"
 #include "debug.h"
@@ -188,6 +190,18 @@ Creature::Creature()
     fake = false;
 }
 
+static std::uint64_t next_creature_id = 0;
+
+Creature::unique_id::unique_id() : value( next_creature_id++ ) {}
+
+Creature::unique_id::unique_id( const unique_id & ) noexcept : unique_id() {}
+
+Creature::unique_id &Creature::unique_id::operator=( const unique_id & ) noexcept
+{
+    value = next_creature_id++;
+    return *this;
+}
+
 Creature::Creature( const Creature & ) = default;
 Creature::Creature( Creature && ) noexcept( map_is_noexcept &&list_is_noexcept ) = default;
 Creature &Creature::operator=( const Creature & ) = default;
@@ -452,7 +466,17 @@ bool Creature::sees( const Creature &critter ) const
     if( &critter == this ) {
         return true;
     }
+    creature_visibility_cache &cache = get_creature_visibility_cache();
+    if( const std::optional<bool> cached = cache.find( *this, critter ) ) {
+        return *cached;
+    }
+    const bool seen = sees_uncached( critter );
+    cache.store( *this, critter, seen );
+    return seen;
+}
 
+bool Creature::sees_uncached( const Creature &critter ) const
+{
     if( std::abs( posz() - critter.posz() ) > fov_3d_z_range ) {
         return false;
     }
@@ -499,6 +523,16 @@ bool Creature::sees( const Creature &critter ) const
                visible( ch );
     }
 
+    // A monster can only see the avatar from where the avatar could see it, so if the avatar's
+    // seen cache has nothing on this tile there's no need to work out lighting and range.
+    if( critter.is_avatar() && is_monster() && here.inbounds( pos_bub() ) ) {
+        if( here.get_cache_ref( posz() ).seen_cache[posx()][posy()] <= LIGHT_TRANSPARENCY_SOLID ) {
+            get_creature_visibility_cache().count_symmetric();
+            return false;
+        }
+        get_creature_visibility_cache().count_fallback();
+    }
+
     // If we cannot see without any of the penalties below, bail now.
     if( !sees( critter.pos_bub(), critter.is_avatar() ) ) {
         return false;
@@ -1755,6 +1789,7 @@ void Creature::add_effect( const effect_source &source, const efftype_id &eff_id
             e.set_intensity( e.get_max_intensity() );
         }
         ( *effects )[eff_id][bp] = e;
+        visibility_revision++;
         if( Character *ch = as_character() ) {
             get_event_bus().send<event_type::character_gains_effect>( ch->getID(), bp.id(), eff_id );
             if( is_avatar() ) {
@@ -1829,6 +1864,7 @@ void Creature::clear_effects()
         }
     }
     effects->clear();
+    visibility_revision++;
 }
 bool Creature::remove_effect( const efftype_id &eff_id, const bodypart_id &bp )
 {
@@ -1836,6 +1872,7 @@ bool Creature::remove_effect( const efftype_id &eff_id, const bodypart_id &bp )
         //Effect doesn't exist, so do nothing
         return false;
     }
+    visibility_revision++;
     const effect_type &type = eff_id.obj();
 
     if( Character *ch = as_character() ) {
@@ -4,6 +4,7 @@
 
 #include <array>
 #include <climits>
+#include <cstdint>
 #include <functional>
 #include <list>
 #include <map>
@@ -397,6 +398,22 @@ class Creature : public viewer
         bool sees( const tripoint_bub_ms &t, bool is_avatar = false, int range_mod = 0 ) const override;
         /*@}*/
 
+        /**
+         * Changes whenever an effect is added or removed, the movement mode changes or, for
+         * characters, worn or wielded items, mutations or enchantments change, all of which decide
+         * e.g. whether the creature is hidden. Used to validate cached sees() results.
+         */
+        unsigned int get_visibility_revision() const {
+            return visibility_revision;
+        }
+        /**
+         * Identifies the creature to the sees() cache. Unlike its address it is never reused, not
+         * even by copies of the creature.
+         */
+        std::uint64_t get_visibility_id() const {
+            return visibility_id.value;
+        }
+
         /**
          * How far the creature sees under the given light. Creature cannot see places outside this range.
          * @param light_level See @ref game::light_level.
@@ -779,6 +796,16 @@ class Creature : public viewer
 
         /** The creature's position in absolute coordinates */
         tripoint_abs_ms location;
+
+        // Takes a new value whenever it is created, copied or assigned
+        struct unique_id {
+            std::uint64_t value;
+            unique_id();
+            unique_id( const unique_id & ) noexcept;
+            unique_id &operator=( const unique_id & ) noexcept;
+        };
+        // See get_visibility_id()
+        unique_id visibility_id; // NOLINT(cata-serialize)
     protected:
         // Sets the creature's position without any side-effects.
         void set_pos_only( const tripoint &p );
@@ -1204,6 +1231,8 @@ class Creature : public viewer
     protected:
         // How many moves do we have to work with
         int moves;
+        // See get_visibility_revision()
+        unsigned int visibility_revision = 0; // NOLINT(cata-serialize)
         Creature *killer; // whoever killed us. this should be NULL unless we are dead
         void set_killer( Creature *killer );
         std::optional<time_point> lifespan_end = std::nullopt;
@@ -1335,6 +1364,8 @@ class Creature : public viewer
 
     private:
         int pain;
+        // Creature::sees( const Creature & ) without the visibility cache
+        bool sees_uncached( const Creature &critter ) const;
         // calculate how well the projectile hits
         double accuracy_projectile_attack( dealt_projectile_attack &attack ) const;
         // what bodypart does the projectile hit
@@ -0,0 +1,65 @@
+#include "creature_visibility.h"
+
+#include "creature.h"
+
+static bool visibility_cache_enabled = true;
+
+creature_visibility_cache &get_creature_visibility_cache()
+{
+    static creature_visibility_cache cache;
+    return cache;
+}
+
+void creature_visibility_cache::set_enabled( bool enabled )
+{
+    visibility_cache_enabled = enabled;
+    get_creature_visibility_cache().clear();
+}
+
+bool creature_visibility_cache::is_enabled()
+{
+    return visibility_cache_enabled;
+}
+
+void creature_visibility_cache::clear()
+{
+    entries.clear();
+}
+
+std::optional<bool> creature_visibility_cache::find( const Creature &observer,
+        const Creature &target )
+{
+    if( !visibility_cache_enabled ) {
+        return std::nullopt;
+    }
+    if( cached_turn != calendar::turn ) {
+        entries.clear();
+        cached_turn = calendar::turn;
+        return std::nullopt;
+    }
+    const auto iter = entries.find( key( observer.get_visibility_id(),
+                                      target.get_visibility_id() ) );
+    if( iter == entries.end() || iter->second.observer_pos != observer.get_location() ||
+        iter->second.target_pos != target.get_location() ||
+        iter->second.observer_revision != observer.get_visibility_revision() ||
+        iter->second.target_revision != target.get_visibility_revision() ) {
+        return std::nullopt;
+    }
+    stats.hits++;
+    return iter->second.seen;
+}
+
+void creature_visibility_cache::store( const Creature &observer, const Creature &target,
+                                       bool seen )
+{
+    stats.misses++;
+    if( !visibility_cache_enabled ) {
+        return;
+    }
+    entry &e = entries[key( observer.get_visibility_id(), target.get_visibility_id() )];
+    e.observer_pos = observer.get_location();
+    e.target_pos = target.get_location();
+    e.observer_revision = observer.get_visibility_revision();
+    e.target_revision = target.get_visibility_revision();
+    e.seen = seen;
+}
@@ -0,0 +1,95 @@
+#pragma once
+#ifndef CATA_SRC_CREATURE_VISIBILITY_H
+#define CATA_SRC_CREATURE_VISIBILITY_H
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <optional>
+#include <unordered_map>
+#include <utility>
+
+#include "calendar.h"
+#include "coordinates.h"
+
+class Creature;
+
+/**
+ * Per-turn cache of Creature::sees( const Creature & ) results, keyed by the visibility ids of
+ * observer and target, which unlike their addresses are never reused by another creature.
+ *
+ * Monster planning, NPC danger assessment, the monster list and targeting all ask whether one
+ * creature sees another, often several times for the same pair in a turn, and every time the
+ * lighting, range and line of sight checks are redone. The cache remembers the answer for the
+ * pair together with both positions and visibility revisions (effects, movement mode, worn and
+ * wielded items, mutations and enchantments), so a move or such a change of either creature makes
+ * the entry stale.
+ *
+ * Everything else the answer depends on changes rarely within a turn, so instead of being tracked
+ * per entry it clears the whole cache: the turn changing, the map caches (transparency, light,
+ * the avatar's seen cache) being rebuilt, the avatar taking an action (e.g. putting on a cloak)
+ * and creatures being freed.
+ */
+class creature_visibility_cache
+{
+    public:
+        struct counters {
+            // Answered from the cache
+            int hits = 0;
+            // Computed and added to the cache
+            int misses = 0;
+            // Monster looking for the avatar, answered from the avatar's seen cache
+            int symmetric = 0;
+            // Monster looking for the avatar, where the seen cache did not settle it
+            int fallbacks = 0;
+        };
+
+        /** Cached result of observer.sees( target ), if there is a valid one. */
+        std::optional<bool> find( const Creature &observer, const Creature &target );
+        void store( const Creature &observer, const Creature &target, bool seen );
+
+        void count_symmetric() {
+            stats.symmetric++;
+        }
+        void count_fallback() {
+            stats.fallbacks++;
+        }
+
+        /** Drops everything, see the class description for when this is needed. */
+        void clear();
+
+        const counters &get_counters() const {
+            return stats;
+        }
+        void reset_counters() {
+            stats = counters();
+        }
+
+        /** Test hook: when disabled every query is evaluated from scratch and nothing is cached. */
+        static void set_enabled( bool enabled );
+        static bool is_enabled();
+
+    private:
+        using key = std::pair<std::uint64_t, std::uint64_t>;
+        struct key_hash {
+            size_t operator()( const key &k ) const {
+                return ( std::hash<std::uint64_t>()( k.first ) * 31 ) ^
+                       std::hash<std::uint64_t>()( k.second );
+            }
+        };
+        struct entry {
+            tripoint_abs_ms observer_pos;
+            tripoint_abs_ms target_pos;
+            unsigned int observer_revision = 0;
+            unsigned int target_revision = 0;
+            bool seen = false;
+        };
+
+        time_point cached_turn = calendar::before_time_starts;
+        std::unordered_map<key, entry, key_hash> entries;
+        counters stats;
+};
+
+creature_visibility_cache &get_creature_visibility_cache();
+
+#endif // CATA_SRC_CREATURE_VISIBILITY_H
@@ -70,6 +70,7 @@
 #include "item.h"
 #include "item_group.h"
 #include "item_location.h"
+#include "item_memory_census.h"
 #include "itype.h"
 #include "json.h"
 #include "localized_comparator.h"
@@ -270,6 +271,7 @@ std::string enum_to_string<debug_menu::debug_menu_index>( debug_menu::debug_menu
 		case debug_menu::debug_menu_index::SIX_MILLION_DOLLAR_SURVIVOR: return "SIX_MILLION_DOLLAR_SURVIVOR";
 		case debug_menu::debug_menu_index::EDIT_FACTION: return "EDIT_FACTION";
 		case debug_menu::debug_menu_index::WRITE_CITY_LIST: return "WRITE_CITY_LIST";
+		case debug_menu::debug_menu_index::ITEM_MEMORY_CENSUS: return "ITEM_MEMORY_CENSUS";
         // *INDENT-ON*
         case debug_menu::debug_menu_index::last:
             break;
@@ -804,6 +806,7 @@ static int info_uilist( bool display_all_entries = true )
             { uilist_entry( debug_menu_index::TEST_MAP_EXTRA_DISTRIBUTION, true, 'e', _( "Test map extra list" ) ) },
             { uilist_entry( debug_menu_index::GENERATE_EFFECT_LIST, true, 'L', _( "Generate effect list" ) ) },
             { uilist_entry( debug_menu_index::WRITE_CITY_LIST, true, 'C', _( "Write city list to cities.output" ) ) },
+            { uilist_entry( debug_menu_index::ITEM_MEMORY_CENSUS, true, 'K', _( "Item memory census" ) ) },
         };
         uilist_initializer.insert( uilist_initializer.begin(), debug_only_options.begin(),
                                    debug_only_options.end() );
@@ -4032,6 +4035,11 @@ void debug()
             break;
         case debug_menu_index::TEST_WEATHER: {
             get_weather().get_cur_weather_gen().test_weather( g->get_seed() );
+            const weather_noise_memo::counters &memo = get_weather_noise_memo().get_counters();
+            const int lookups = memo.hits + memo.misses;
+            popup( _( "Weather written to weather.output.\n\n"
+                      "Weather noise memo: %d hits, %d misses, %.1f%% hit rate." ),
+                   memo.hits, memo.misses, lookups ? 100.0 * memo.hits / lookups : 0.0 );
         }
         break;
         case debug_menu_index::WRITE_GLOBAL_EOCS: {
@@ -4165,6 +4173,10 @@ void debug()
             faction_edit_menu();
             break;
 
+        case debug_menu_index::ITEM_MEMORY_CENSUS:
+            popup( item_memory_census::take().report( 20 ), PF_NONE );
+            break;
+
         case debug_menu_index::WRITE_CITY_LIST:
             write_city_list();
 
@@ -26,11 +26,14 @@
 #include "cata_variant.h"
 #include "clzones.h"
 #include "coordinates.h"
+#include "creature_tracker.h"
+#include "creature_visibility.h"
 #include "debug.h"
 #include "enums.h"
 #include "event.h"
 #include "event_bus.h"
 #include "explosion.h"
+#include "field.h"
 #include "game.h"
 #include "game_constants.h"
 #include "gamemode.h"
@@ -78,6 +81,9 @@
 static const activity_id ACT_AUTODRIVE( "ACT_AUTODRIVE" );
 static const activity_id ACT_FIRSTAID( "ACT_FIRSTAID" );
 static const activity_id ACT_OPERATION( "ACT_OPERATION" );
+static const activity_id ACT_WAIT( "ACT_WAIT" );
+static const activity_id ACT_WAIT_STAMINA( "ACT_WAIT_STAMINA" );
+static const activity_id ACT_WAIT_WEATHER( "ACT_WAIT_WEATHER" );
 
 static const bionic_id bio_alarm( "bio_alarm" );
 
@@ -90,6 +96,12 @@ static const event_statistic_id event_statistic_last_words( "last_words" );
 
 static const trait_id trait_HAS_NEMESIS( "HAS_NEMESIS" );
 
+static const option_handle<bool> option_AUTOSAVE( "AUTOSAVE" );
+static const option_handle<int> option_AUTOSAVE_TURNS( "AUTOSAVE_TURNS" );
+static const option_handle<std::string> option_ETERNAL_WEATHER( "ETERNAL_WEATHER" );
+static const option_handle<bool> option_FORCE_REDRAW( "FORCE_REDRAW" );
+static const option_handle<bool> option_WANDER_SPAWNS( "WANDER_SPAWNS" );
+
 #if defined(__ANDROID__)
 extern std::map<std::string, std::list<input_event>> quick_shortcuts_map;
 extern bool add_best_key_for_action_to_quick_shortcuts( action_id action,
@@ -98,6 +110,13 @@ extern bool add_best_key_for_action_to_quick_shortcuts( action_id action,
 
 #define dbg(x) DebugLog((x),D_GAME) << __FILE__ << ":" << __LINE__ << ": "
 
+// Fields within this distance of the avatar prevent fast-forwarding
+static constexpr int fast_forward_field_radius = 5;
+// How often scent and map caches are refreshed while fast-forwarding
+static constexpr time_duration fast_forward_refresh = 1_minutes;
+// Set when a fast-forwarded turn skipped the map cache update
+static bool fast_forward_caches_stale = false;
+
 namespace turn_handler
 {
 bool cleanup_at_end()
@@ -436,6 +455,69 @@ void overmap_npc_move()
 
 } // namespace
 
+bool can_fast_forward_turn()
+{
+    const avatar &u = get_avatar();
+    if( g->uquit == QUIT_WATCH ) {
+        return false;
+    }
+    const activity_id &act = u.activity.id();
+    if( !u.has_effect( effect_sleep ) && act != ACT_WAIT && act != ACT_WAIT_STAMINA &&
+        act != ACT_WAIT_WEATHER ) {
+        return false;
+    }
+    if( !get_creature_tracker().get_monsters_list().empty() ) {
+        return false;
+    }
+    for( const npc &guy : g->all_npcs() ) {
+        if( !guy.is_player_ally() ) {
+            return false;
+        }
+    }
+    map &m = get_map();
+    if( u.in_vehicle ) {
+        const vehicle *veh = veh_pointer_or_null( m.veh_at( u.pos_bub() ) );
+        if( veh && veh->velocity != 0 ) {
+            return false;
+        }
+    }
+    for( const tripoint_bub_ms &p : m.points_in_radius( u.pos_bub(), fast_forward_field_radius ) ) {
+        if( m.field_at( p ).field_count() > 0 ) {
+            return false;
+        }
+    }
+    return true;
+}
+
+void update_world_caches( bool fast_forward )
+{
+    const bool refresh = !fast_forward || calendar::once_every( fast_forward_refresh );
+    avatar &u = get_avatar();
+    map &m = get_map();
+    if( refresh ) {
+        get_scent().update( u.pos(), m );
+    }
+
+    // We need floor cache before checking falling 'n stuff
+    m.build_floor_caches();
+
+    m.process_falling();
+    m.vehmove();
+    m.process_fields();
+    m.process_items();
+    explosion_handler::process_explosions();
+    m.creature_in_field( u );
+
+    // Apply sounds from previous turn to monster and NPC AI.
+    sounds::process_sounds();
+    // Update vision caches for monsters. If this turns out to be expensive,
+    // consider a stripped down cache just for monsters.
+    if( refresh ) {
+        m.build_map_cache( m.get_abs_sub().z(), true );
+    }
+    fast_forward_caches_stale = !refresh;
+}
+
 // MAIN GAME LOOP
 // Returns true if game is over (death, saved, quit, etc)
 bool do_turn()
@@ -448,9 +530,8 @@ bool do_turn()
     // Actual stuff
     if( g->new_game ) {
         g->new_game = false;
-        if( get_option<std::string>( "ETERNAL_WEATHER" ) != "normal" ) {
-            weather.weather_override = static_cast<weather_type_id>
-                                       ( get_option<std::string>( "ETERNAL_WEATHER" ) );
+        if( option_ETERNAL_WEATHER.get() != "normal" ) {
+            weather.weather_override = static_cast<weather_type_id>( option_ETERNAL_WEATHER.get() );
             weather.set_nextweather( calendar::turn );
         } else {
             weather.weather_override = WEATHER_NULL;
@@ -502,7 +583,7 @@ bool do_turn()
     // Move hordes every 2.5 min
     if( calendar::once_every( time_duration::from_minutes( 2.5 ) ) ) {
 
-        if( get_option<bool>( "WANDER_SPAWNS" ) ) {
+        if( option_WANDER_SPAWNS.get() ) {
             overmap_buffer.move_hordes();
         }
         if( u.has_trait( trait_HAS_NEMESIS ) ) {
@@ -518,8 +599,8 @@ bool do_turn()
     u.update_body();
 
     // Auto-save if autosave is enabled
-    if( get_option<bool>( "AUTOSAVE" ) &&
-        calendar::once_every( 1_turns * get_option<int>( "AUTOSAVE_TURNS" ) ) &&
+    if( option_AUTOSAVE.get() &&
+        calendar::once_every( 1_turns * option_AUTOSAVE_TURNS.get() ) &&
         !u.is_dead_state() ) {
         g->autosave();
     }
@@ -528,6 +609,9 @@ bool do_turn()
     g->reset_light_level();
 
     g->perhaps_add_random_npc( /* ignore_spawn_timers_and_rates = */ false );
+    if( speculative_mapgen ) {
+        m.generate_ahead( std::chrono::milliseconds( 5 ) );
+    }
     while( u.get_moves() > 0 && u.activity ) {
         u.activity.do_turn( u );
     }
@@ -555,6 +639,12 @@ bool do_turn()
     if( !u.has_effect( effect_sleep ) || g->uquit == QUIT_WATCH ) {
         if( u.get_moves() > 0 || g->uquit == QUIT_WATCH ) {
             while( u.get_moves() > 0 || g->uquit == QUIT_WATCH ) {
+                if( fast_forward_caches_stale && !u.activity ) {
+                    // The wait ended or was interrupted and the player is about to look around,
+                    // so catch up on the skipped vision updates once
+                    m.build_map_cache( m.get_abs_sub().z() );
+                    fast_forward_caches_stale = false;
+                }
                 g->cleanup_dead();
                 g->mon_info_update();
                 // Process any new sounds the player caused during their turn.
@@ -579,6 +669,8 @@ bool do_turn()
                 if( g->handle_action() ) {
                     ++g->moves_since_last_save;
                     u.action_taken();
+                    // The action may have changed what can be seen, e.g. by wearing a cloak
+                    get_creature_visibility_cache().clear();
                 }
 
                 if( g->is_game_over() ) {
@@ -636,24 +728,10 @@ bool do_turn()
         scent.set( u.pos(), u.scent, u.get_type_of_scent() );
         overmap_buffer.set_scent( u.global_omt_location(),  u.scent );
     }
-    scent.update( u.pos(), m );
-
-    // We need floor cache before checking falling 'n stuff
-    m.build_floor_caches();
-
-    m.process_falling();
-    m.vehmove();
-    m.process_fields();
-    m.process_items();
-    explosion_handler::process_explosions();
-    m.creature_in_field( u );
-
-    // Apply sounds from previous turn to monster and NPC AI.
-    sounds::process_sounds();
+    // Nothing around can smell or see while the avatar sleeps or waits alone, so only
+    // refresh scent and vision caches occasionally then
+    update_world_caches( can_fast_forward_turn() );
     const int levz = m.get_abs_sub().z();
-    // Update vision caches for monsters. If this turns out to be expensive,
-    // consider a stripped down cache just for monsters.
-    m.build_map_cache( levz, true );
     monmove();
     if( calendar::once_every( time_between_npc_OM_moves ) ) {
         overmap_npc_move();
@@ -674,7 +752,7 @@ bool do_turn()
     }
     g->mon_info_update();
     u.process_turn();
-    if( u.get_moves() < 0 && get_option<bool>( "FORCE_REDRAW" ) ) {
+    if( u.get_moves() < 0 && option_FORCE_REDRAW.get() ) {
         ui_manager::redraw();
         refresh_display();
     }
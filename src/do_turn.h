@@ -6,4 +6,19 @@
 bool do_turn();
 void handle_key_blocking_activity();
 
+/**
+ * Whether the current turn may be fast-forwarded: the avatar is asleep or waiting, and nothing
+ * in the reality bubble could interrupt them (no monsters, no NPCs other than allies, no
+ * fields close to the avatar and no moving vehicle). On such turns do_turn() only refreshes the
+ * scent map and the map caches once every few turns, since nobody is there to smell or see.
+ * The check is repeated every turn, so normal simulation resumes as soon as anything changes.
+ */
+bool can_fast_forward_turn();
+
+/**
+ * Updates the scent map and the vision caches of the current z-level. When fast_forward is
+ * set this only happens once every fast-forward refresh interval.
+ */
+void update_world_caches( bool fast_forward );
+
 #endif // CATA_SRC_DO_TURN_H
@@ -1600,7 +1600,7 @@ void load_effect_type( const JsonObject &jo, const std::string_view src )
 
     new_etype.impairs_movement = hardcoded_movement_impairing.count( new_etype.id ) > 0;
 
-    new_etype.flags = jo.get_tags<flag_id>( "flags" );
+    new_etype.flags = jo.get_tags<flag_id, cata::flat_id_set<flag_id>>( "flags" );
     int enchant_num = 0;
     for( JsonValue jv : jo.get_array( "enchantments" ) ) {
         std::string enchant_name = "INLINE_ENCH_" + new_etype.id.str() + "_" + std::to_string(
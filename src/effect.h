@@ -19,6 +19,7 @@
 #include "effect_source.h"
 #include "enums.h"
 #include "event.h"
+#include "flat_id_map.h"
 #include "flat_set.h"
 #include "translation.h"
 #include "type_id.h"
@@ -194,7 +195,7 @@ class effect_type
         time_duration int_dur_factor = 0_turns;
         bool int_decay_remove = false;
 
-        std::set<flag_id> flags;
+        cata::flat_id_set<flag_id> flags;
 
         bool main_parts_only = false;
 
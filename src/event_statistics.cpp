@@ -481,8 +481,7 @@ struct event_transformation_impl : public event_transformation::impl {
         }
 
         void events_reset( const event_multiset &new_value, stats_tracker &stats ) override {
-            data_ = transformation_->initialize(
-                        new_value.counts(), cached_value_constraints_, stats );
+            data_ = transformation_->initialize( new_value, cached_value_constraints_, stats );
             stats.transformed_set_changed( transformation_->id_, data_ );
         }
 
@@ -605,25 +604,24 @@ struct event_transformation_impl : public event_transformation::impl {
     }
 
     event_multiset initialize(
-        const event_multiset::summaries_type &input,
+        const event_multiset &input,
         const std::list<updatable_value_constraint> &cached_value_constraints,
         stats_tracker & ) const {
         event_multiset result;
 
-        for( const std::pair<const cata::event::data_type, event_summary> &p : input ) {
-            cata::event::data_type event_data = p.first;
+        input.visit( [&]( const cata::event::data_type & event_data, const event_summary & summary ) {
             EventVector transformed = match_and_transform( event_data, cached_value_constraints );
             for( cata::event::data_type &d : transformed ) {
-                result.add( { d, p.second } );
+                result.add( { d, summary } );
             }
-        }
+        } );
         return result;
     }
 
     event_multiset initialize(
         const std::list<updatable_value_constraint> &cached_value_constraints,
         stats_tracker &stats ) const {
-        return initialize( source_->get( stats ).counts(), cached_value_constraints, stats );
+        return initialize( source_->get( stats ), cached_value_constraints, stats );
     }
 
     event_multiset initialize( stats_tracker &stats ) const override {
@@ -1008,12 +1006,12 @@ struct event_statistic_unique_value : event_statistic_field_summary<false> {
     using event_statistic_field_summary::event_statistic_field_summary;
 
     cata_variant value( stats_tracker &stats ) const override {
-        const event_multiset::summaries_type summaries = source->get( stats ).counts();
-        if( summaries.size() != 1 ) {
+        const event_multiset events = source->get( stats );
+        if( events.size() != 1 ) {
             return cata_variant();
         }
 
-        const cata::event::data_type &d = summaries.begin()->first;
+        const cata::event::data_type d = events.first()->first;
         auto it = d.find( field );
         if( it == d.end() ) {
             return cata_variant();
@@ -1,5 +1,8 @@
 #include "flag.h"
 
+#include <cstddef>
+#include <cstdint>
+
 #include "debug.h"
 #include "flexbuffer_json-inl.h"
 #include "flexbuffer_json.h"
@@ -466,3 +469,22 @@ const std::vector<json_flag> &json_flag::get_all()
 {
     return json_flags_all.get_all();
 }
+
+int_id<json_flag> flag_bitset::bit_of( const flag_id &flag )
+{
+    return json_flags_all.convert( flag, int_id<json_flag>( -1 ), false );
+}
+
+void flag_bitset::add( const flag_id &flag )
+{
+    const int i = bit_of( flag ).to_i();
+    if( i < 0 ) {
+        complete = false;
+        return;
+    }
+    const std::size_t word = static_cast<std::size_t>( i / 64 );
+    if( word >= words.size() ) {
+        words.resize( word + 1 );
+    }
+    words[word] |= std::uint64_t( 1 ) << ( i % 64 );
+}
@@ -2,6 +2,8 @@
 #ifndef CATA_SRC_FLAG_H
 #define CATA_SRC_FLAG_H
 
+#include <cstddef>
+#include <cstdint>
 #include <set>
 #include <string>
 #include <string_view>
@@ -496,4 +498,60 @@ class json_flag
         static void reset();
 };
 
+/**
+ * One bit per loaded flag, indexed by the int_id the flag got when it was loaded, so testing for
+ * a flag is a single bit test. Only as many words are kept as the highest bit that is set needs.
+ *
+ * The bits are built from a set of flag_ids, which stays what is iterated, saved and loaded.
+ * Flags that were not loaded when the bits were built have no bit, the bits are incomplete then
+ * and the set has to be asked instead. Default constructed bits are incomplete too.
+ */
+class flag_bitset
+{
+    public:
+        /** Index of the flag's bit, negative if the flag is not loaded. */
+        static int_id<json_flag> bit_of( const flag_id &flag );
+
+        template<typename Flags>
+        void assign( const Flags &flags ) {
+            words.clear();
+            complete = true;
+            for( const flag_id &f : flags ) {
+                add( f );
+            }
+        }
+        void add( const flag_id &flag );
+
+        /** Whether the flags the bits were built from include flag, if the bits are complete. */
+        bool test( const flag_id &flag ) const {
+            return test( bit_of( flag ) );
+        }
+        bool test( const int_id<json_flag> &bit ) const {
+            const std::size_t i = static_cast<std::size_t>( bit.to_i() );
+            return i / 64 < words.size() && ( ( words[i / 64] >> ( i % 64 ) ) & 1 ) != 0;
+        }
+        bool is_complete() const {
+            return complete;
+        }
+        /** test() if the bits are complete, otherwise looks flag up in the set they are built from. */
+        template<typename Flags>
+        bool contains( const Flags &flags, const flag_id &flag ) const {
+            return contains( flags, flag, bit_of( flag ) );
+        }
+        /** As above, for a flag whose bit_of() is already known. */
+        template<typename Flags>
+        bool contains( const Flags &flags, const flag_id &flag, const int_id<json_flag> &bit ) const {
+            return complete ? test( bit ) : flags.count( flag ) > 0;
+        }
+
+        /** Bytes allocated for the bits, see item::memory_usage. */
+        std::size_t memory_usage() const {
+            return words.capacity() * sizeof( std::uint64_t );
+        }
+
+    private:
+        std::vector<std::uint64_t> words;
+        bool complete = false;
+};
+
 #endif // CATA_SRC_FLAG_H
@@ -0,0 +1,245 @@
+#pragma once
+#ifndef CATA_SRC_FLAT_ID_MAP_H
+#define CATA_SRC_FLAT_ID_MAP_H
+
+#include <algorithm>
+#include <cstddef>
+#include <initializer_list>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include "int_id.h"
+#include "string_id.h"
+
+namespace cata
+{
+
+/** The int a flat_id_set or flat_id_map sorts and searches by. */
+template<typename T>
+int id_key( const string_id<T> &id )
+{
+    return id.interned_index();
+}
+template<typename T>
+int id_key( const int_id<T> &id )
+{
+    return id.to_i();
+}
+
+/**
+ * @brief Set of string_id or int_id, kept as a sorted vector of their int keys.
+ *
+ * Like cata::flat_set, but lookups binary search a plain array of ints (see id_key) instead of
+ * the ids themselves, so a lookup touches a few cache lines and never the strings. Iterates in
+ * the order of the keys, which for string_id is the same as std::set<string_id>: not
+ * lexicographic and not the same after a restart.
+ */
+template<typename Id>
+class flat_id_set
+{
+    public:
+        using key_type = Id;
+        using value_type = Id;
+        using size_type = std::size_t;
+        using const_iterator = typename std::vector<Id>::const_iterator;
+        using iterator = const_iterator;
+
+        flat_id_set() = default;
+        template<typename InputIt>
+        flat_id_set( InputIt first, InputIt last ) {
+            for( ; first != last; ++first ) {
+                insert( *first );
+            }
+        }
+        flat_id_set( std::initializer_list<Id> init ) : flat_id_set( init.begin(), init.end() ) {}
+
+        size_type size() const {
+            return ids.size();
+        }
+        bool empty() const {
+            return ids.empty();
+        }
+        void clear() {
+            keys.clear();
+            ids.clear();
+        }
+        void reserve( size_type n ) {
+            keys.reserve( n );
+            ids.reserve( n );
+        }
+
+        iterator begin() const {
+            return ids.begin();
+        }
+        iterator end() const {
+            return ids.end();
+        }
+
+        iterator find( const Id &id ) const {
+            const std::ptrdiff_t at = position( id_key( id ) );
+            return at < 0 ? end() : begin() + at;
+        }
+        size_type count( const Id &id ) const {
+            return position( id_key( id ) ) < 0 ? 0 : 1;
+        }
+
+        std::pair<iterator, bool> insert( const Id &id ) {
+            const int key = id_key( id );
+            const auto at = std::lower_bound( keys.begin(), keys.end(), key );
+            const std::ptrdiff_t index = at - keys.begin();
+            if( at != keys.end() && *at == key ) {
+                return { begin() + index, false };
+            }
+            keys.insert( at, key );
+            ids.insert( ids.begin() + index, id );
+            return { begin() + index, true };
+        }
+        template<typename InputIt>
+        void insert( InputIt first, InputIt last ) {
+            for( ; first != last; ++first ) {
+                insert( *first );
+            }
+        }
+
+        size_type erase( const Id &id ) {
+            const std::ptrdiff_t at = position( id_key( id ) );
+            if( at < 0 ) {
+                return 0;
+            }
+            keys.erase( keys.begin() + at );
+            ids.erase( ids.begin() + at );
+            return 1;
+        }
+        iterator erase( iterator it ) {
+            const std::ptrdiff_t at = it - begin();
+            keys.erase( keys.begin() + at );
+            return ids.erase( ids.begin() + at );
+        }
+
+        friend bool operator==( const flat_id_set &l, const flat_id_set &r ) {
+            return l.keys == r.keys;
+        }
+        friend bool operator!=( const flat_id_set &l, const flat_id_set &r ) {
+            return l.keys != r.keys;
+        }
+
+    private:
+        // Index of key, or -1
+        std::ptrdiff_t position( int key ) const {
+            const auto at = std::lower_bound( keys.begin(), keys.end(), key );
+            return at != keys.end() && *at == key ? at - keys.begin() : -1;
+        }
+
+        std::vector<int> keys;
+        std::vector<Id> ids;
+};
+
+/**
+ * @brief Map from string_id or int_id, kept as sorted vectors of the int keys and the entries.
+ *
+ * See flat_id_set. The entries are std::pair<Id, T> rather than std::pair<const Id, T>, the
+ * id in them must not be changed. Inserting or erasing invalidates iterators and references,
+ * so this is no drop-in replacement for maps that are changed while being iterated over.
+ */
+template<typename Id, typename T>
+class flat_id_map
+{
+    public:
+        using key_type = Id;
+        using mapped_type = T;
+        using value_type = std::pair<Id, T>;
+        using size_type = std::size_t;
+        using iterator = typename std::vector<value_type>::iterator;
+        using const_iterator = typename std::vector<value_type>::const_iterator;
+
+        size_type size() const {
+            return entries.size();
+        }
+        bool empty() const {
+            return entries.empty();
+        }
+        void clear() {
+            keys.clear();
+            entries.clear();
+        }
+        void reserve( size_type n ) {
+            keys.reserve( n );
+            entries.reserve( n );
+        }
+
+        iterator begin() {
+            return entries.begin();
+        }
+        iterator end() {
+            return entries.end();
+        }
+        const_iterator begin() const {
+            return entries.begin();
+        }
+        const_iterator end() const {
+            return entries.end();
+        }
+
+        iterator find( const Id &id ) {
+            const std::ptrdiff_t at = position( id_key( id ) );
+            return at < 0 ? end() : begin() + at;
+        }
+        const_iterator find( const Id &id ) const {
+            const std::ptrdiff_t at = position( id_key( id ) );
+            return at < 0 ? end() : begin() + at;
+        }
+        size_type count( const Id &id ) const {
+            return position( id_key( id ) ) < 0 ? 0 : 1;
+        }
+
+        template<typename... Args>
+        std::pair<iterator, bool> emplace( const Id &id, Args &&... args ) {
+            const int key = id_key( id );
+            const auto at = std::lower_bound( keys.begin(), keys.end(), key );
+            const std::ptrdiff_t index = at - keys.begin();
+            if( at != keys.end() && *at == key ) {
+                return { begin() + index, false };
+            }
+            keys.insert( at, key );
+            entries.emplace( entries.begin() + index, std::piecewise_construct,
+                             std::forward_as_tuple( id ),
+                             std::forward_as_tuple( std::forward<Args>( args )... ) );
+            return { begin() + index, true };
+        }
+        std::pair<iterator, bool> insert( const value_type &value ) {
+            return emplace( value.first, value.second );
+        }
+        T &operator[]( const Id &id ) {
+            return emplace( id ).first->second;
+        }
+
+        size_type erase( const Id &id ) {
+            const std::ptrdiff_t at = position( id_key( id ) );
+            if( at < 0 ) {
+                return 0;
+            }
+            keys.erase( keys.begin() + at );
+            entries.erase( entries.begin() + at );
+            return 1;
+        }
+        iterator erase( const_iterator it ) {
+            const std::ptrdiff_t at = it - entries.cbegin();
+            keys.erase( keys.begin() + at );
+            return entries.erase( it );
+        }
+
+    private:
+        // Index of key, or -1
+        std::ptrdiff_t position( int key ) const {
+            const auto at = std::lower_bound( keys.begin(), keys.end(), key );
+            return at != keys.end() && *at == key ? at - keys.begin() : -1;
+        }
+
+        std::vector<int> keys;
+        std::vector<value_type> entries;
+};
+
+} // namespace cata
+
+#endif // CATA_SRC_FLAT_ID_MAP_H
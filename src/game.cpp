@@ -76,6 +76,7 @@
 #include "coordinate_conversions.h"
 #include "coordinates.h"
 #include "creature_tracker.h"
+#include "creature_visibility.h"
 #include "cuboid_rectangle.h"
 #include "cursesport.h" // IWYU pragma: keep
 #include "damage.h"
@@ -1265,6 +1266,7 @@ void game::unload_npcs()
     }
 
     critter_tracker->clear_npcs();
+    get_creature_visibility_cache().clear();
 }
 
 void game::remove_npc( character_id const &id )
@@ -1276,6 +1278,7 @@ void game::remove_npc( character_id const &id )
     } );
     if( it != active_npc.end() ) {
         active_npc.erase( it );
+        get_creature_visibility_cache().clear();
     }
 }
 
@@ -3737,6 +3740,10 @@ shared_ptr_fast<ui_adaptor> game::create_or_get_main_ui_adaptor()
         ui->on_redraw( []( ui_adaptor & ui ) {
             g->draw( ui );
         } );
+#if defined(TILES)
+        // Only the uncovered area and the map tiles that changed get repainted
+        ui->enable_partial_redraw();
+#endif
         ui->on_screen_resize( [this]( ui_adaptor & ui ) {
             // remove some space for the sidebar, this is the maximal space
             // (using standard font) that the terrain window can have
@@ -3973,6 +3980,9 @@ void game::draw( ui_adaptor &ui )
     m.build_map_cache( ter_view_p.z );
     m.update_visibility_cache( ter_view_p.z );
 
+#if defined(TILES)
+    tilecontext->set_lost_area( ui.damaged_region() );
+#endif
     werase( w_terrain );
     void_blink_curses();
     draw_ter();
@@ -4620,6 +4630,7 @@ void game::cleanup_dead()
     if( monster_is_dead ) {
         // From here on, pointers to creatures get invalidated as dead creatures get removed.
         critter_tracker->remove_dead();
+        get_creature_visibility_cache().clear();
     }
 
     if( npc_is_dead ) {
@@ -4633,6 +4644,7 @@ void game::cleanup_dead()
                 it++;
             }
         }
+        get_creature_visibility_cache().clear();
     }
 
     critter_died = false;
@@ -5088,11 +5100,13 @@ bool game::update_zombie_pos( const monster &critter, const tripoint_abs_ms &old
 void game::remove_zombie( const monster &critter )
 {
     critter_tracker->remove( critter );
+    get_creature_visibility_cache().clear();
 }
 
 void game::clear_zombies()
 {
     critter_tracker->clear();
+    get_creature_visibility_cache().clear();
 }
 
 bool game::find_nearby_spawn_point( const tripoint &target, const mtype_id &mt, int min_radius,
@@ -12691,6 +12705,22 @@ point game::update_map( int &x, int &y, bool z_level_changed )
     // Update what parts of the world map we can see
     update_overmap_seen();
 
+    if( prefetch_submaps || speculative_mapgen ) {
+        // Prepare what lies ahead while the player keeps moving, further ahead in fast vehicles:
+        // roughly one more overmap terrain per 25 mph.
+        int distance = 2;
+        if( const optional_vpart_position vp = m.veh_at( u.pos_bub() ) ) {
+            distance += 2 * std::min( 3, std::abs( vp->vehicle().velocity ) / 2500 );
+        }
+        if( prefetch_submaps ) {
+            MAPBUFFER.prefetch( m.quads_ahead( point_rel_sm( shift ), distance, true ) );
+        }
+        if( speculative_mapgen ) {
+            // Mapgen generates all z-levels of a column at once
+            m.queue_mapgen_ahead( m.quads_ahead( point_rel_sm( shift ), distance, false ) );
+        }
+    }
+
     return shift;
 }
 
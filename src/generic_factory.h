@@ -15,6 +15,7 @@
 #include "cata_type_traits.h"
 #include "debug.h"
 #include "enum_bitset.h"
+#include "flat_id_map.h"
 #include "init.h"
 #include "int_id.h"
 #include "json.h"
@@ -917,6 +918,20 @@ struct handler<std::set<T>> {
     static constexpr bool is_container = true;
 };
 
+template<typename T>
+struct handler<cata::flat_id_set<T>> {
+    void clear( cata::flat_id_set<T> &container ) const {
+        container.clear();
+    }
+    void insert( cata::flat_id_set<T> &container, const T &data ) const {
+        container.insert( data );
+    }
+    void erase( cata::flat_id_set<T> &container, const T &data ) const {
+        container.erase( data );
+    }
+    static constexpr bool is_container = true;
+};
+
 template<size_t N>
 struct handler<std::bitset<N>> {
     void clear( std::bitset<N> &container ) const {
@@ -304,10 +304,11 @@ item &inventory::add_item( item newit, bool keep_invlet, bool assign_invlet, boo
 
     Character &player_character = get_player_character();
     if( should_stack ) {
+        const size_t fingerprint = newit.stacking_fingerprint();
         // See if we can't stack this item.
         for( auto &elem : items ) {
             std::list<item>::iterator it_ref = elem.begin();
-            if( it_ref->stacks_with( newit ) ) {
+            if( it_ref->stacking_fingerprint() == fingerprint && it_ref->stacks_with( newit ) ) {
                 if( it_ref->merge_charges( newit ) ) {
                     return *it_ref;
                 }
@@ -418,8 +419,10 @@ void inventory::restack( Character &p )
     // combine matching stacks
     // separate loop to ensure that ALL stacks are homogeneous
     for( invstack::iterator iter = items.begin(); iter != items.end(); ++iter ) {
+        const size_t fingerprint = iter->front().stacking_fingerprint();
         for( invstack::iterator other = iter; other != items.end(); ++other ) {
-            if( iter != other && iter->front().stacks_with( other->front() ) ) {
+            if( iter != other && other->front().stacking_fingerprint() == fingerprint &&
+                iter->front().stacks_with( other->front() ) ) {
                 if( other->front().count_by_charges() ) {
                     iter->front().charges += other->front().charges;
                 } else {
@@ -601,6 +601,9 @@ void inventory_entry::update_cache()
     cached_name = &names.sort_key;
     contents_count = names.contents_count;
     cached_name_full = &names.full_name;
+    if( is_item() ) {
+        cached_stacking_fingerprint = any_item()->stacking_fingerprint();
+    }
 }
 
 void inventory_entry::cache_denial( inventory_selector_preset const &preset ) const
@@ -1297,10 +1300,11 @@ inventory_entry *inventory_column::add_entry( const inventory_entry &entry )
     paging_is_valid = false;
     if( entry.is_item() ) {
         item_location entry_item = entry.locations.front();
+        const size_t fingerprint = entry_item->stacking_fingerprint();
 
         auto entry_with_loc = std::find_if( dest.begin(),
-        dest.end(), [&entry, &entry_item, this]( const inventory_entry & e ) {
-            if( !e.is_item() ) {
+        dest.end(), [&entry, &entry_item, fingerprint, this]( const inventory_entry & e ) {
+            if( !e.is_item() || e.cached_stacking_fingerprint != fingerprint ) {
                 return false;
             }
             item_location found_entry_item = e.locations.front();
@@ -1490,9 +1494,20 @@ void inventory_column::prepare_paging( const std::string &filter )
         return preset.get_filter( filter );
     } );
 
-    const auto is_visible = [&filter_fn, &filter, this]( inventory_entry const & it ) {
+    const auto matches_filter = [&filter_fn, &filter]( inventory_entry const & it ) {
+        if( !it.filtered_out_by.empty() && filter_only_narrows( it.filtered_out_by, filter ) ) {
+            return false;
+        }
+        if( !filter_fn( it ) ) {
+            it.filtered_out_by = filter;
+            return false;
+        }
+        it.filtered_out_by.clear();
+        return true;
+    };
+    const auto is_visible = [&matches_filter, &filter, this]( inventory_entry const & it ) {
         return it.is_item() &&
-               ( filter_fn( it ) &&
+               ( matches_filter( it ) &&
                  ( ( !filter.empty() && !it.is_collation_entry() ) || !it.is_hidden( hide_entries_override ) ) );
     };
     const auto is_not_visible = [&is_visible, this]( inventory_entry const & it ) {
@@ -2401,6 +2416,8 @@ void inventory_selector::prepare_layout()
 {
     startup_timer const tp_prep =
         std::chrono::time_point_cast<std::chrono::milliseconds>( std::chrono::steady_clock::now() );
+    // Filtering, sorting and measuring the columns twice all name the same entries
+    tname::cache_scope names;
 
     const auto snap = []( size_t cur_dim, size_t max_dim ) {
         return cur_dim + 2 * max_win_snap_distance >= max_dim ? max_dim : cur_dim;
@@ -2643,6 +2660,8 @@ void inventory_selector::resize_window( int width, int height )
 void inventory_selector::refresh_window()
 {
     cata_assert( w_inv );
+    // Entries are named for highlighting, widths and drawing
+    tname::cache_scope names;
 
     if( get_option<std::string>( "INVENTORY_HIGHLIGHT" ) != "disable" ) {
         highlight();
@@ -73,6 +73,7 @@ class inventory_entry
         std::string *cached_name_full = nullptr;
         unsigned int contents_count = 0;
         size_t cached_denial_space = 0;
+        size_t cached_stacking_fingerprint = 0;
 
         inventory_entry() = default;
 
@@ -184,6 +185,8 @@ class inventory_entry
         mutable bool enabled = true;
         void cache_denial( inventory_selector_preset const &preset ) const;
         mutable std::optional<std::string> denial;
+        // Filter that rejected this entry, so narrower filters can skip it
+        mutable std::string filtered_out_by;
 
         void set_custom_category( const item_category *category ) {
             custom_category = category;
@@ -56,6 +56,7 @@
 #include "game.h"
 #include "game_constants.h"
 #include "gun_mode.h"
+#include "hash_utils.h"
 #include "iexamine.h"
 #include "inventory.h"
 #include "item_category.h"
@@ -392,7 +393,10 @@ item::item( const itype *type, time_point turn, int qty ) : type( type ), bday(
     }
 
     if( !type->snippet_category.empty() ) {
-        snip_id = SNIPPET.random_id_from_category( type->snippet_category );
+        const snippet_id snippet = SNIPPET.random_id_from_category( type->snippet_category );
+        if( !snippet.is_null() ) {
+            cold().snip_id = snippet;
+        }
     }
 
     if( type->expand_snippets ) {
@@ -633,7 +637,9 @@ item item::make_corpse( const mtype_id &mt, time_point turn, const std::string &
 
     // This is unconditional because the const itemructor above sets result.name to
     // "human corpse".
-    result.corpse_name = name;
+    if( !name.empty() ) {
+        result.cold().corpse_name = name;
+    }
 
     return result;
 }
@@ -1705,7 +1711,10 @@ stacking_info item::stacks_with( const item &rhs, bool check_components, bool co
     bits.set( tname::segments::CUSTOM_ITEM_SUFFIX, bits[tname::segments::TAGS] );
 
     bits.set( tname::segments::FAULTS, faults == rhs.faults );
-    bits.set( tname::segments::TECHNIQUES, techniques == rhs.techniques );
+    const bool no_techniques = ( !cold_ || cold_->techniques.empty() ) &&
+                               ( !rhs.cold_ || rhs.cold_->techniques.empty() );
+    bits.set( tname::segments::TECHNIQUES, no_techniques ||
+              ( cold_ && rhs.cold_ && cold_->techniques == rhs.cold_->techniques ) );
     bits.set( tname::segments::OVERHEAT, overheat_symbol() == rhs.overheat_symbol() );
     bits.set( tname::segments::DIRT, get_var( "dirt", 0 ) == rhs.get_var( "dirt", 0 ) );
     bits.set( tname::segments::SEALED, all_pockets_sealed() == rhs.all_pockets_sealed() );
@@ -1739,7 +1748,7 @@ stacking_info item::stacks_with( const item &rhs, bool check_components, bool co
     bits.set( tname::segments::CORPSE,
               ( corpse == nullptr && rhs.corpse == nullptr ) ||
               ( corpse != nullptr && rhs.corpse != nullptr && corpse->id == rhs.corpse->id &&
-                corpse_name == rhs.corpse_name ) );
+                get_corpse_name() == rhs.get_corpse_name() ) );
     bits.set( tname::segments::FOOD_PERISHABLE, _stacks_food_perishable( *this, rhs, check_cat ) );
     bits.set( tname::segments::CLOTHING_SIZE, _stacks_clothing_size( *this, rhs ) );
     bits.set( tname::segments::BROKEN, is_broken() == rhs.is_broken() );
@@ -1763,6 +1772,22 @@ stacking_info item::stacks_with( const item &rhs, bool check_components, bool co
     return { bits };
 }
 
+size_t item::stacking_fingerprint() const
+{
+    size_t seed = std::hash<const itype *>()( type );
+    cata::hash_combine( seed, has_itype_variant() ? itype_variant().id : std::string() );
+    // charges only count for items that are not counted by charges, see stacks_with
+    cata::hash_combine( seed, count_by_charges() ? 0 : charges );
+    cata::hash_combine( seed, damage_level() );
+    cata::hash_combine( seed, degradation_ );
+    cata::hash_combine( seed, is_favorite );
+    cata::hash_combine( seed, burnt );
+    cata::hash_combine( seed, active );
+    cata::hash_combine( seed, faults.size() );
+    cata::hash_combine( seed, corpse );
+    return seed;
+}
+
 bool item::same_contents( const item &rhs ) const
 {
     return get_contents().same_contents( rhs.get_contents() );
@@ -2444,6 +2469,7 @@ void item::basic_info( std::vector<iteminfo> &info, const iteminfo_query *parts,
         insert_separation_line( info );
         const std::map<std::string, std::string>::const_iterator idescription =
             item_vars.find( "description" );
+        const snippet_id &snip_id = get_snippet();
         const std::optional<translation> snippet = SNIPPET.get_snippet_by_id( snip_id );
         if( snippet.has_value() ) {
             // Just use the dynamic description
@@ -5548,8 +5574,7 @@ void item::melee_combat_info( std::vector<iteminfo> &info, const iteminfo_query
     }
 
     if( parts->test( iteminfo_parts::DESCRIPTION_TECHNIQUES ) ) {
-        std::set<matec_id> all_techniques = type->techniques;
-        all_techniques.insert( techniques.begin(), techniques.end() );
+        const std::set<matec_id> all_techniques = get_techniques();
 
         if( !all_techniques.empty() ) {
             const std::vector<matec_id> all_tec_sorted = sorted_lex( all_techniques );
@@ -6735,12 +6760,15 @@ void item::update_inherited_flags()
         }
     }
     update_prefix_suffix_flags();
+    update_tag_bits();
 }
 
 void item::update_prefix_suffix_flags()
 {
-    prefix_tags_cache.clear();
-    suffix_tags_cache.clear();
+    if( cold_ ) {
+        cold_->prefix_tags_cache.clear();
+        cold_->suffix_tags_cache.clear();
+    }
     auto const insert_prefix_suffix_flags = [this]( FlagsSetType const & Flags ) {
         for( flag_id const &f : Flags ) {
             update_prefix_suffix_flags( f );
@@ -6754,10 +6782,25 @@ void item::update_prefix_suffix_flags()
 void item::update_prefix_suffix_flags( const flag_id &f )
 {
     if( !f->item_prefix().empty() ) {
-        prefix_tags_cache.emplace( f );
+        cold().prefix_tags_cache.emplace( f );
     }
     if( !f->item_suffix().empty() ) {
-        suffix_tags_cache.emplace( f );
+        cold().suffix_tags_cache.emplace( f );
+    }
+}
+
+void item::update_tag_bits()
+{
+    if( item_tags.empty() && inherited_tags_cache.empty() ) {
+        tag_bits.reset();
+        return;
+    }
+    if( !tag_bits ) {
+        tag_bits = cata::make_value<flag_bitset>();
+    }
+    tag_bits->assign( *item_tags );
+    for( const flag_id &f : *inherited_tags_cache ) {
+        tag_bits->add( f );
     }
 }
 
@@ -6855,6 +6898,10 @@ std::string item::tname( unsigned int quantity, bool with_prefix ) const
 
 std::string item::tname( unsigned int quantity, tname::segment_bitset const &segments ) const
 {
+    if( const std::string *cached = tname::cache_scope::find( *this, quantity, segments ) ) {
+        return *cached;
+    }
+
     std::string ret;
 
     for( size_t i = 0; i < static_cast<size_t>( tname::segments::last_segment ); i++ ) {
@@ -6867,9 +6914,10 @@ std::string item::tname( unsigned int quantity, tname::segment_bitset const &seg
 
     if( item_vars.find( "item_note" ) != item_vars.end() ) {
         //~ %s is an item name. This style is used to denote items with notes.
-        return string_format( _( "*%s*" ), ret );
+        ret = string_format( _( "*%s*" ), ret );
     }
 
+    tname::cache_scope::store( *this, quantity, segments, ret );
     return ret;
 }
 
@@ -7596,6 +7644,7 @@ int item::current_reach_range( const Character &guy ) const
 void item::unset_flags()
 {
     item_tags.clear();
+    update_tag_bits();
     requires_tags_processing = true;
 }
 
@@ -7621,26 +7670,25 @@ bool item::has_own_flag( const flag_id &f ) const
 
 bool item::has_flag( const flag_id &f ) const
 {
-    bool ret = false;
-    if( !f.is_valid() ) {
+    const int_id<json_flag> bit = flag_bitset::bit_of( f );
+    if( bit.to_i() < 0 ) {
         debugmsg( "Attempted to check invalid flag_id %s", f.str() );
         return false;
     }
 
-    ret = inherited_tags_cache.find( f ) != inherited_tags_cache.end();
-    if( ret ) {
-        return ret;
+    // item type flags
+    if( type->has_flag( f, bit ) ) {
+        return true;
     }
 
-    // other item type flags
-    ret = type->has_flag( f );
-    if( ret ) {
-        return ret;
+    // inherited and item specific flags, there are none without bits
+    if( !tag_bits ) {
+        return false;
     }
-
-    // now check for item specific flags
-    ret = has_own_flag( f );
-    return ret;
+    if( tag_bits->is_complete() ) {
+        return tag_bits->test( bit );
+    }
+    return inherited_tags_cache.find( f ) != inherited_tags_cache.end() || has_own_flag( f );
 }
 
 item &item::set_flag( const flag_id &flag )
@@ -7648,6 +7696,7 @@ item &item::set_flag( const flag_id &flag )
     if( flag.is_valid() ) {
         item_tags.insert( flag );
         update_prefix_suffix_flags( flag );
+        update_tag_bits();
         requires_tags_processing = true;
     } else {
         debugmsg( "Attempted to set invalid flag_id %s", flag.str() );
@@ -7686,6 +7735,7 @@ item &item::unset_flag( const flag_id &flag )
 {
     item_tags.erase( flag );
     update_prefix_suffix_flags();
+    update_tag_bits();
     requires_tags_processing = true;
     return *this;
 }
@@ -7708,12 +7758,14 @@ const item::FlagsSetType &item::get_flags() const
 
 const item::FlagsSetType &item::get_prefix_flags() const
 {
-    return prefix_tags_cache;
+    static const FlagsSetType none;
+    return cold_ ? cold_->prefix_tags_cache : none;
 }
 
 const item::FlagsSetType &item::get_suffix_flags() const
 {
-    return suffix_tags_cache;
+    static const FlagsSetType none;
+    return cold_ ? cold_->suffix_tags_cache : none;
 }
 
 bool item::has_property( const std::string &prop ) const
@@ -7798,12 +7850,12 @@ int item::get_quality( const quality_id &id, const bool strict_boiling ) const
 
 bool item::has_technique( const matec_id &tech ) const
 {
-    return type->techniques.count( tech ) > 0 || techniques.count( tech ) > 0;
+    return type->techniques.count( tech ) > 0 || ( cold_ && cold_->techniques.count( tech ) > 0 );
 }
 
 void item::add_technique( const matec_id &tech )
 {
-    techniques.insert( tech );
+    cold().techniques.insert( tech );
 }
 
 std::vector<item *> item::toolmods()
@@ -7835,7 +7887,9 @@ std::vector<const item *> item::toolmods() const
 std::set<matec_id> item::get_techniques() const
 {
     std::set<matec_id> result = type->techniques;
-    result.insert( techniques.begin(), techniques.end() );
+    if( cold_ ) {
+        result.insert( cold_->techniques.begin(), cold_->techniques.end() );
+    }
     return result;
 }
 
@@ -12493,11 +12547,90 @@ void item::set_snippet( const snippet_id &id )
     if( is_null() ) {
         return;
     }
-    if( !id.is_valid() ) {
+    if( !id.is_null() && !id.is_valid() ) {
         debugmsg( "there's no snippet with id %s", id.str() );
         return;
     }
-    snip_id = id;
+    if( !id.is_null() || cold_ ) {
+        cold().snip_id = id;
+    }
+}
+
+const snippet_id &item::get_snippet() const
+{
+    static const snippet_id none = snippet_id::NULL_ID();
+    return cold_ ? cold_->snip_id : none;
+}
+
+int item::get_frequency() const
+{
+    return cold_ ? cold_->frequency : 0;
+}
+
+void item::set_frequency( int frequency )
+{
+    if( frequency != 0 || cold_ ) {
+        cold().frequency = frequency;
+    }
+}
+
+item::cold_data &item::cold()
+{
+    if( !cold_ ) {
+        cold_ = cata::make_value<cold_data>();
+    }
+    return *cold_;
+}
+
+// Rough heap usage of the elements of a node based container such as std::set or std::map:
+// every node holds the value and a few pointers of bookkeeping
+template<typename Container>
+static size_t node_bytes( const Container &container )
+{
+    return container.size() * ( sizeof( typename Container::value_type ) + 4 * sizeof( void * ) );
+}
+
+// Heap usage of a string that outgrew the small string buffer
+static size_t string_bytes( const std::string &str )
+{
+    return str.capacity() > 15 ? str.capacity() + 1 : 0;
+}
+
+size_t item::memory_usage() const
+{
+    size_t bytes = sizeof( item );
+    // The cata::heap members are always allocated
+    bytes += sizeof( *faults ) + node_bytes( *faults );
+    bytes += sizeof( *item_tags ) + node_bytes( *item_tags );
+    bytes += sizeof( *inherited_tags_cache ) + node_bytes( *inherited_tags_cache );
+    bytes += sizeof( *item_vars ) + node_bytes( *item_vars );
+    for( const std::pair<const std::string, std::string> &var : *item_vars ) {
+        bytes += string_bytes( var.first ) + string_bytes( var.second );
+    }
+    if( cold_ ) {
+        bytes += sizeof( cold_data ) + string_bytes( cold_->corpse_name ) +
+                 node_bytes( cold_->techniques ) + node_bytes( cold_->prefix_tags_cache ) +
+                 node_bytes( cold_->suffix_tags_cache );
+    }
+    if( craft_data_ ) {
+        bytes += sizeof( craft_data );
+    }
+    if( relic_data ) {
+        bytes += sizeof( relic );
+    }
+    if( link_ ) {
+        bytes += sizeof( link_data );
+    }
+    if( tag_bits ) {
+        bytes += sizeof( flag_bitset ) + tag_bits->memory_usage();
+    }
+    for( const item_components::type_vector_pair &comp : components ) {
+        bytes += sizeof( comp ) + 4 * sizeof( void * );
+        for( const item &it : comp.second ) {
+            bytes += it.memory_usage();
+        }
+    }
+    return bytes + contents.memory_usage();
 }
 
 const item_category &item::get_category_shallow() const
@@ -14714,6 +14847,7 @@ std::string item::type_name( unsigned int quantity, bool use_variant, bool use_c
 
     // Identify who this corpse belonged to, if applicable.
     if( corpse != nullptr && use_corpse && has_flag( flag_CORPSE ) ) {
+        const std::string corpse_name = get_corpse_name();
         if( corpse_name.empty() ) {
             //~ %1$s: name of corpse with modifiers;  %2$s: species name
             ret_name = string_format( pgettext( "corpse ownership qualifier", "%1$s of a %2$s" ),
@@ -14735,7 +14869,7 @@ const mtype *item::get_corpse_mon() const
 
 std::string item::get_corpse_name() const
 {
-    return corpse_name;
+    return cold_ ? cold_->corpse_name : std::string();
 }
 
 std::string item::nname( const itype_id &id, unsigned int quantity )
@@ -21,6 +21,7 @@
 #include "cata_utility.h"
 #include "compatibility.h"
 #include "enums.h"
+#include "flag.h"
 #include "gun_mode.h"
 #include "io_tags.h"
 #include "item_components.h"
@@ -408,6 +409,8 @@ class item : public visitable
          * @param quantity used for translation to the proper plural form of the name, e.g.
          * returns "rock" for quantity 1 and "rocks" for quantity > 0.
          * @param segments determines which tname elements are included
+         *
+         * While a tname::cache_scope exists, names are built once per item, quantity and segments.
          */
         std::string tname( unsigned int quantity = 1,
                            tname::segment_bitset const &segments = tname::default_tname ) const;
@@ -630,6 +633,12 @@ class item : public visitable
         stacking_info stacks_with( const item &rhs, bool check_components = false,
                                    bool combine_liquid = false, bool check_cat = false,
                                    int depth = 0, int maxdepth = 2, bool precise = false ) const;
+        /**
+         * Hash of the state stacks_with requires to be equal whatever its arguments, so items
+         * that stack always have the same fingerprint. Grouping code can bucket items by it and
+         * only call stacks_with within a bucket. It is cheap enough to not need caching.
+         */
+        size_t stacking_fingerprint() const;
 
         /**
          * Whether the two items have same contents.
@@ -1796,6 +1805,18 @@ class item : public visitable
          * @see snippet_library.
          */
         void set_snippet( const snippet_id &id );
+        /** The snippet set with @ref set_snippet, or the null id. */
+        const snippet_id &get_snippet() const;
+
+        /** Radio frequency the item is tuned to, 0 if none. */
+        int get_frequency() const;
+        void set_frequency( int frequency );
+
+        /**
+         * Rough number of bytes this item takes: the item itself, everything it allocates and
+         * its pockets, but not the items in those pockets.
+         */
+        size_t memory_usage() const;
 
         bool operator<( const item &other ) const;
         /** List of all @ref components in printable form, empty if this item has
@@ -3065,6 +3086,8 @@ class item : public visitable
         */
         void update_prefix_suffix_flags();
         void update_prefix_suffix_flags( const flag_id &flag );
+        /** Rebuilds tag_bits, after item_tags or inherited_tags_cache changed. */
+        void update_tag_bits();
 
     public:
         enum class sizing : int {
@@ -3120,13 +3143,27 @@ class item : public visitable
         bool requires_tags_processing = true;
         cata::heap<FlagsSetType> item_tags; // generic item specific flags
         cata::heap<FlagsSetType> inherited_tags_cache;
-        cata::heap<FlagsSetType> prefix_tags_cache; // flags that will add prefixes to this item
-        cata::heap<FlagsSetType> suffix_tags_cache; // flags that will add suffixes to this item
+        // Bits of item_tags and inherited_tags_cache, only allocated while either has flags
+        cata::value_ptr<flag_bitset> tag_bits;
         lazy<safe_reference_anchor> anchor;
         cata::heap<std::map<std::string, std::string>> item_vars;
         const mtype *corpse = nullptr;
-        std::string corpse_name;       // Name of the late lamented
-        cata::heap<std::set<matec_id>> techniques; // item specific techniques
+
+        /**
+         * Members that only few items ever set. They live in a block of their own that is
+         * allocated when one of them is first set, so the other items don't carry them.
+         */
+        struct cold_data {
+            std::string corpse_name;       // Name of the late lamented
+            std::set<matec_id> techniques; // item specific techniques
+            FlagsSetType prefix_tags_cache; // flags that will add prefixes to this item
+            FlagsSetType suffix_tags_cache; // flags that will add suffixes to this item
+            int frequency = 0;             // Radio frequency
+            snippet_id snip_id = snippet_id::NULL_ID(); // Associated dynamic text snippet id.
+        };
+        cata::value_ptr<cold_data> cold_;
+        // Allocates the cold block if needed
+        cold_data &cold();
 
         // Select a random variant from the possibilities
         // Intended to be called when no explicit variant is set
@@ -3172,8 +3209,6 @@ class item : public visitable
         int recipe_charges = 1;    // The number of charges a recipe creates.
         int burnt = 0;             // How badly we're burnt
         int poison = 0;            // How badly poisoned is it?
-        int frequency = 0;         // Radio frequency
-        snippet_id snip_id = snippet_id::NULL_ID(); // Associated dynamic text snippet id.
         int irradiation = 0;       // Tracks radiation dosage.
         int item_counter = 0;      // generic counter to be used with item flags
 
@@ -3240,6 +3275,7 @@ class item : public visitable
         };
         mutable cat_cache cached_category;
 
+
         // additional encumbrance this specific item has
         units::volume additional_encumbrance = 0_ml;
 
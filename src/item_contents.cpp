@@ -663,6 +663,19 @@ size_t item_contents::size() const
     return contents.size();
 }
 
+size_t item_contents::memory_usage() const
+{
+    // Each list node holds the pocket and two links
+    size_t bytes = contents.size() * ( sizeof( item_pocket ) + 2 * sizeof( void * ) );
+    for( const item_pocket &pocket : contents ) {
+        bytes += pocket.memory_usage();
+    }
+    for( const item &it : additional_pockets ) {
+        bytes += it.memory_usage();
+    }
+    return bytes;
+}
+
 void item_contents::read_mods( const item_contents &read_input )
 {
     for( const item_pocket &pocket : read_input.contents ) {
@@ -108,6 +108,8 @@ class item_contents
         bool bigger_on_the_inside( const units::volume &container_volume ) const;
         // number of pockets
         size_t size() const;
+        // bytes taken by the pockets, not counting the items in them, see item::memory_usage
+        size_t memory_usage() const;
 
         /** returns a list of pointers to all top-level items from pockets that match the predicate */
         std::list<item *> all_items_top( const std::function<bool( item_pocket & )> &filter );
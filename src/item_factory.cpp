@@ -732,6 +732,7 @@ void Item_factory::finalize_post( itype &obj )
         }
         return false;
     } );
+    obj.item_tag_bits.assign( obj.item_tags );
 
     if( obj.gun && !obj.gunmod && !obj.has_flag( flag_PRIMITIVE_RANGED_WEAPON ) ) {
         const quality_id qual_gun_skill( to_upper_case( obj.gun->skill_used.str() ) );
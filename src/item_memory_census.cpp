@@ -0,0 +1,111 @@
+#include "item_memory_census.h"
+
+#include <algorithm>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "avatar.h"
+#include "character.h"
+#include "game.h"
+#include "game_constants.h"
+#include "item.h"
+#include "itype.h"
+#include "mapbuffer.h"
+#include "npc.h"
+#include "point.h"
+#include "string_formatter.h"
+#include "submap.h"
+#include "vehicle.h"
+#include "visitable.h"
+
+void item_memory_census::count( totals &in_place, const item &it )
+{
+    const size_t bytes = it.memory_usage();
+    for( totals *t : {
+             &total, &in_place, &by_type[it.typeId()]
+         } ) {
+        t->count++;
+        t->bytes += bytes;
+    }
+}
+
+void item_memory_census::add( const std::string &place, const item &it )
+{
+    totals &in_place = by_place[place];
+    it.visit_items( [&]( const item * node, const item * ) {
+        count( in_place, *node );
+        return VisitResponse::NEXT;
+    } );
+}
+
+void item_memory_census::add( const std::string &place, const submap &sm )
+{
+    for( int x = 0; x < SEEX; x++ ) {
+        for( int y = 0; y < SEEY; y++ ) {
+            for( const item &it : sm.get_items( point_sm_ms( x, y ) ) ) {
+                add( place, it );
+            }
+        }
+    }
+}
+
+void item_memory_census::add( const std::string &place, const vehicle &veh )
+{
+    for( int i = 0; i < veh.part_count(); i++ ) {
+        const vehicle_part &vp = veh.part( i );
+        add( place, vp.get_base() );
+        for( const item &it : veh.get_items( vp ) ) {
+            add( place, it );
+        }
+    }
+}
+
+void item_memory_census::add( const std::string &place, const Character &who )
+{
+    totals &in_place = by_place[place];
+    who.visit_items( [&]( const item * node, const item * ) {
+        count( in_place, *node );
+        return VisitResponse::NEXT;
+    } );
+}
+
+item_memory_census item_memory_census::take()
+{
+    item_memory_census census;
+    for( const std::pair<const tripoint_abs_sm, std::unique_ptr<submap>> &entry : MAPBUFFER ) {
+        census.add( "map", *entry.second );
+        for( const std::unique_ptr<vehicle> &veh : entry.second->vehicles ) {
+            census.add( "vehicles", *veh );
+        }
+    }
+    census.add( "characters", get_avatar() );
+    for( const npc &guy : g->all_npcs() ) {
+        census.add( "characters", guy );
+    }
+    return census;
+}
+
+std::string item_memory_census::report( size_t types_shown ) const
+{
+    std::string ret = string_format( "%d items, %d KiB, %d bytes per item object\n\n", total.count,
+                                     total.bytes / 1024, sizeof( item ) );
+    for( const std::pair<const std::string, totals> &place : by_place ) {
+        ret += string_format( "%s: %d items, %d KiB\n", place.first, place.second.count,
+                              place.second.bytes / 1024 );
+    }
+    std::vector<std::pair<itype_id, totals>> types( by_type.begin(), by_type.end() );
+    std::sort( types.begin(), types.end(), []( const std::pair<itype_id, totals> &lhs,
+    const std::pair<itype_id, totals> &rhs ) {
+        return lhs.second.bytes > rhs.second.bytes;
+    } );
+    types.resize( std::min( types.size(), types_shown ) );
+    ret += "\n";
+    for( const std::pair<itype_id, totals> &type : types ) {
+        const size_t each = type.second.bytes /
+                            static_cast<size_t>( std::max( type.second.count, 1 ) );
+        ret += string_format( "%s: %d items, %d KiB, %d bytes each\n", type.first.str(),
+                              type.second.count, type.second.bytes / 1024, each );
+    }
+    return ret;
+}
@@ -0,0 +1,66 @@
+#pragma once
+#ifndef CATA_SRC_ITEM_MEMORY_CENSUS_H
+#define CATA_SRC_ITEM_MEMORY_CENSUS_H
+
+#include <cstddef>
+#include <map>
+#include <string>
+
+#include "type_id.h"
+
+class Character;
+class item;
+class submap;
+class vehicle;
+
+/**
+ * Counts the items in memory and the bytes they take, by item type and by where they are kept.
+ * Every item is counted with its own bytes (see item::memory_usage), the items in its pockets
+ * are counted separately under their own types.
+ */
+class item_memory_census
+{
+    public:
+        struct totals {
+            int count = 0;
+            size_t bytes = 0;
+        };
+
+        /** Adds the item and everything in its pockets, kept in the given place. */
+        void add( const std::string &place, const item &it );
+        /** Adds the items on the ground of the submap. */
+        void add( const std::string &place, const submap &sm );
+        /** Adds the base items of the vehicle's parts and the items in its cargo. */
+        void add( const std::string &place, const vehicle &veh );
+        /** Adds what the character wears, wields and carries. */
+        void add( const std::string &place, const Character &who );
+
+        /**
+         * Census of everything loaded: the submaps in the map buffer, their vehicles, the avatar
+         * and the loaded NPCs.
+         */
+        static item_memory_census take();
+
+        const totals &get_total() const {
+            return total;
+        }
+        const std::map<itype_id, totals> &get_by_type() const {
+            return by_type;
+        }
+        const std::map<std::string, totals> &get_by_place() const {
+            return by_place;
+        }
+
+        /** Summary for the debug menu, listing the item types with the most bytes first. */
+        std::string report( size_t types_shown ) const;
+
+    private:
+        // Adds a single item, without its contents
+        void count( totals &in_place, const item &it );
+
+        totals total;
+        std::map<itype_id, totals> by_type;
+        std::map<std::string, totals> by_place;
+};
+
+#endif // CATA_SRC_ITEM_MEMORY_CENSUS_H
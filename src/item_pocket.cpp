@@ -492,6 +492,13 @@ std::list<const item *> item_pocket::all_items_top() const
     return items;
 }
 
+size_t item_pocket::memory_usage() const
+{
+    // The links of the list nodes holding the items, and the nodes of the set
+    return contents.size() * 2 * sizeof( void * ) +
+           no_rigid.size() * ( sizeof( sub_bodypart_id ) + 4 * sizeof( void * ) );
+}
+
 std::list<item *> item_pocket::all_items_ptr( pocket_type pk_type )
 {
     if( !is_type( pk_type ) ) {
@@ -165,6 +165,8 @@ class item_pocket
 
         std::list<item *> all_items_top();
         std::list<const item *> all_items_top() const;
+        // bytes allocated by the pocket, not counting the items in it, see item::memory_usage
+        size_t memory_usage() const;
         std::list<item *> all_items_ptr( pocket_type pk_type );
         std::list<const item *> all_items_ptr( pocket_type pk_type ) const;
 
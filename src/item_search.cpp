@@ -4,6 +4,7 @@
 #include <utility>
 
 #include "avatar.h"
+#include "cached_options.h"
 #include "cata_utility.h"
 #include "item.h"
 #include "item_category.h"
@@ -134,3 +135,22 @@ std::pair<std::string, std::string> get_both( const std::string_view a )
     return std::pair( std::string( a.substr( 0, split_mark ) ),
                       std::string( a.substr( split_mark + 1 ) ) );
 }
+
+bool filter_only_narrows( const std::string &previous, const std::string &filter )
+{
+    if( previous.empty() ) {
+        return true;
+    }
+    if( use_pinyin_search || filter.compare( 0, previous.size(), previous ) != 0 ||
+        filter.find_first_of( ",-{}" ) != std::string::npos ) {
+        return false;
+    }
+    const size_t colon = filter.find( ':' );
+    if( colon != previous.find( ':' ) ) {
+        // A prefix was added, the search now looks at something else than before
+        return false;
+    }
+    // Flags must match exactly, and "both" splits the query in two
+    return colon == std::string::npos || colon == 0 ||
+           ( filter[colon - 1] != 'f' && filter[colon - 1] != 'b' );
+}
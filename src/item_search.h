@@ -96,4 +96,13 @@ std::function<bool( const item & )> item_filter_from_string( const std::string &
  */
 std::function<bool( const item & )> basic_item_filter( std::string filter );
 
+/**
+ * Whether everything matching filter also matches previous, as when a character is typed at
+ * the end of a search. The filter then has to be checked only against what previous matched.
+ * This is the case when filter extends previous without adding alternatives (commas),
+ * exclusions (minuses) or a different search prefix, and the prefix is one that matches
+ * substrings.
+ */
+bool filter_only_narrows( const std::string &previous, const std::string &filter );
+
 #endif // CATA_SRC_ITEM_SEARCH_H
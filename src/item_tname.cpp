@@ -1,7 +1,9 @@
 #include "item_tname.h"
 
+#include <memory>
 #include <set>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #include "avatar.h"
@@ -618,4 +620,56 @@ std::string print_segment( tname::segments segment, item const &it, unsigned int
     size_t const idx = static_cast<size_t>( segment );
     return ( *arr.at( idx ) )( it, quantity, segments );
 }
+
+namespace
+{
+struct cached_name {
+    unsigned int quantity;
+    segment_bitset segments;
+    std::string name;
+};
+using name_map = std::unordered_map<const item *, std::vector<cached_name>>;
+// Names stored by the outermost cache_scope of this thread, null if there is none
+thread_local std::unique_ptr<name_map> scoped_names;
+} // namespace
+
+cache_scope::cache_scope() : outermost( scoped_names == nullptr )
+{
+    if( outermost ) {
+        scoped_names = std::make_unique<name_map>();
+    }
+}
+
+cache_scope::~cache_scope()
+{
+    if( outermost ) {
+        scoped_names.reset();
+    }
+}
+
+const std::string *cache_scope::find( const item &it, unsigned int quantity,
+                                      const segment_bitset &segments )
+{
+    if( scoped_names == nullptr ) {
+        return nullptr;
+    }
+    const auto iter = scoped_names->find( &it );
+    if( iter == scoped_names->end() ) {
+        return nullptr;
+    }
+    for( const cached_name &entry : iter->second ) {
+        if( entry.quantity == quantity && entry.segments == segments ) {
+            return &entry.name;
+        }
+    }
+    return nullptr;
+}
+
+void cache_scope::store( const item &it, unsigned int quantity, const segment_bitset &segments,
+                         const std::string &name )
+{
+    if( scoped_names != nullptr ) {
+        ( *scoped_names )[&it].push_back( { quantity, segments, name } );
+    }
+}
 } // namespace tname
@@ -119,6 +119,38 @@ constexpr segment_bitset tname_contents( tname_contents_bits );
 constexpr segment_bitset tname_conditional( tname_conditional_bits );
 constexpr segment_bitset item_name( item_name_bits );
 
+#ifndef CATA_IN_TOOL
+
+/**
+ * While an instance exists, item::tname() keeps the names it builds and returns them again when
+ * the same item is named with the same quantity and segments.
+ *
+ * Meant for one pass over a list of items, like laying out or drawing an inventory, which names
+ * the same items several times. The items must not change or go away while the scope exists,
+ * which is why it is not kept any longer than that. Scopes may nest, the names are kept until
+ * the outermost one ends.
+ */
+class cache_scope
+{
+    public:
+        cache_scope();
+        ~cache_scope();
+        cache_scope( const cache_scope & ) = delete;
+        cache_scope &operator=( const cache_scope & ) = delete;
+
+        /** The name stored for it, or nullptr if there is none or no scope exists. */
+        static const std::string *find( const item &it, unsigned int quantity,
+                                        const segment_bitset &segments );
+        /** Keeps name for it if a scope exists. */
+        static void store( const item &it, unsigned int quantity, const segment_bitset &segments,
+                           const std::string &name );
+
+    private:
+        bool outermost;
+};
+
+#endif // CATA_IN_TOOL
+
 } // namespace tname
 
 #endif // CATA_SRC_ITEM_TNAME_H
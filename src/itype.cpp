@@ -163,7 +163,7 @@ bool itype::has_use() const
 
 bool itype::has_flag( const flag_id &flag ) const
 {
-    return item_tags.count( flag );
+    return item_tag_bits.contains( item_tags, flag );
 }
 
 const itype::FlagsSetType &itype::get_flags() const
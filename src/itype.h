@@ -19,6 +19,7 @@
 #include "damage.h"
 #include "enums.h" // point
 #include "explosion.h"
+#include "flag.h"
 #include "game_constants.h"
 #include "item_pocket.h"
 #include "iuse.h" // use_function
@@ -1358,6 +1359,8 @@ struct itype {
         mtype_id source_monster = mtype_id::NULL_ID();
     private:
         FlagsSetType item_tags;
+        // Bits of item_tags, built once the type is finalized
+        flag_bitset item_tag_bits;
 
     public:
         // memory card related per-type static data
@@ -1545,6 +1548,10 @@ struct itype {
         bool has_use() const;
 
         bool has_flag( const flag_id &flag ) const;
+        // As above, for a flag whose flag_bitset::bit_of() is already known
+        bool has_flag( const flag_id &flag, const int_id<json_flag> &bit ) const {
+            return item_tag_bits.contains( item_tags, flag, bit );
+        }
 
         // returns read-only set of all item tags/flags
         const FlagsSetType &get_flags() const;
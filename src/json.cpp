@@ -2223,6 +2223,10 @@ std::string TextJsonIn::substr( size_t pos, size_t len )
     return ret;
 }
 
+static bool json_out_buffering = true;
+// Buffer size at which output is handed to the stream even within a top level value
+static constexpr size_t json_out_flush_size = 1 << 16;
+
 JsonOut::JsonOut( std::ostream &s, bool pretty, int depth ) :
     stream( &s ), pretty_print( pretty ), indent_level( depth )
 {
@@ -2236,13 +2240,53 @@ JsonOut::JsonOut( std::ostream &s, bool pretty, int depth ) :
     stream->setf( std::ios_base::boolalpha );
 }
 
+JsonOut::~JsonOut()
+{
+    flush();
+}
+
+void JsonOut::set_buffering_enabled( bool enabled )
+{
+    json_out_buffering = enabled;
+}
+
+void JsonOut::flush()
+{
+    if( !buffer.empty() ) {
+        stream->write( buffer.data(), buffer.size() );
+        buffer.clear();
+    }
+}
+
+void JsonOut::value_done()
+{
+    if( need_wrap.empty() || !json_out_buffering || buffer.size() >= json_out_flush_size ) {
+        flush();
+    }
+}
+
+void JsonOut::put_float( double val )
+{
+    if( !float_stream ) {
+        float_stream = std::make_unique<std::ostringstream>();
+        float_stream->imbue( std::locale::classic() );
+        float_stream->setf( std::ios_base::showpoint );
+        float_stream->setf( std::ios_base::fixed, std::ostream::floatfield );
+    }
+    float_stream->str( std::string() );
+    *float_stream << val;
+    put( float_stream->str() );
+}
+
 int JsonOut::tell()
 {
+    flush();
     return stream->tellp();
 }
 
 void JsonOut::seek( int pos )
 {
+    flush();
     stream->clear();
     stream->seekp( pos );
     need_separator = false;
@@ -2250,7 +2294,7 @@ void JsonOut::seek( int pos )
 
 void JsonOut::write_indent()
 {
-    std::fill_n( std::ostream_iterator<char>( *stream ), indent_level * 2, ' ' );
+    buffer.append( indent_level * 2, ' ' );
 }
 
 void JsonOut::write_separator()
@@ -2258,15 +2302,15 @@ void JsonOut::write_separator()
     if( !need_separator ) {
         return;
     }
-    stream->put( ',' );
+    put( ',' );
     if( pretty_print ) {
         // Wrap after separator between objects and between members of top-level objects.
         if( indent_level < 2 || need_wrap.back() ) {
-            stream->put( '\n' );
+            put( '\n' );
             write_indent();
         } else {
             // Otherwise pad after commas.
-            stream->put( ' ' );
+            put( ' ' );
         }
     }
     need_separator = false;
@@ -2275,11 +2319,12 @@ void JsonOut::write_separator()
 void JsonOut::write_member_separator()
 {
     if( pretty_print ) {
-        stream->write( ": ", 2 );
+        put( ": " );
     } else {
-        stream->put( ':' );
+        put( ':' );
     }
     need_separator = false;
+    value_done();
 }
 
 void JsonOut::start_pretty()
@@ -2288,11 +2333,11 @@ void JsonOut::start_pretty()
         indent_level += 1;
         // Wrap after top level object and array opening.
         if( indent_level < 2 || need_wrap.back() ) {
-            stream->put( '\n' );
+            put( '\n' );
             write_indent();
         } else {
             // Otherwise pad after opening.
-            stream->put( ' ' );
+            put( ' ' );
         }
     }
 }
@@ -2304,11 +2349,11 @@ void JsonOut::end_pretty()
         // Wrap after ending top level array and object.
         // Also wrap in the special case of exiting an array containing an object.
         if( indent_level < 1 || need_wrap.back() ) {
-            stream->put( '\n' );
+            put( '\n' );
             write_indent();
         } else {
             // Otherwise pad after ending.
-            stream->put( ' ' );
+            put( ' ' );
         }
     }
 }
@@ -2318,7 +2363,7 @@ void JsonOut::start_object( bool wrap )
     if( need_separator ) {
         write_separator();
     }
-    stream->put( '{' );
+    put( '{' );
     need_wrap.push_back( wrap );
     start_pretty();
     need_separator = false;
@@ -2328,8 +2373,9 @@ void JsonOut::end_object()
 {
     end_pretty();
     need_wrap.pop_back();
-    stream->put( '}' );
+    put( '}' );
     need_separator = true;
+    value_done();
 }
 
 void JsonOut::start_array( bool wrap )
@@ -2337,7 +2383,7 @@ void JsonOut::start_array( bool wrap )
     if( need_separator ) {
         write_separator();
     }
-    stream->put( '[' );
+    put( '[' );
     need_wrap.push_back( wrap );
     start_pretty();
     need_separator = false;
@@ -2347,8 +2393,9 @@ void JsonOut::end_array()
 {
     end_pretty();
     need_wrap.pop_back();
-    stream->put( ']' );
+    put( ']' );
     need_separator = true;
+    value_done();
 }
 
 void JsonOut::write_null()
@@ -2356,8 +2403,23 @@ void JsonOut::write_null()
     if( need_separator ) {
         write_separator();
     }
-    stream->write( "null", 4 );
+    put( "null" );
     need_separator = true;
+    value_done();
+}
+
+// Whether any of the eight bytes in word is a control character, '"' or '\\', i.e. needs escaping.
+// Bytes from 0x80 up (UTF-8 sequences) never do.
+static bool needs_json_escape( uint64_t word )
+{
+    constexpr uint64_t ones = 0x0101010101010101ULL;
+    constexpr uint64_t high_bits = 0x8080808080808080ULL;
+    const uint64_t quotes = word ^ ( ones * '"' );
+    const uint64_t backslashes = word ^ ( ones * '\\' );
+    const uint64_t below_space = ( word - ones * 0x20 ) & ~word;
+    const uint64_t zero_quote = ( quotes - ones ) & ~quotes;
+    const uint64_t zero_backslash = ( backslashes - ones ) & ~backslashes;
+    return ( ( below_space | zero_quote | zero_backslash ) & high_bits ) != 0;
 }
 
 void JsonOut::write( const std::string_view val )
@@ -2365,42 +2427,59 @@ void JsonOut::write( const std::string_view val )
     if( need_separator ) {
         write_separator();
     }
-    stream->put( '"' );
-    for( const char &i : val ) {
-        unsigned char ch = i;
+    put( '"' );
+    // Copy runs of characters that don't need escaping at once, skipping over them eight at a time
+    const char *const data = val.data();
+    const size_t size = val.size();
+    size_t run_start = 0;
+    size_t i = 0;
+    while( i < size ) {
+        if( i + 8 <= size ) {
+            uint64_t word;
+            std::memcpy( &word, data + i, sizeof( word ) );
+            if( !needs_json_escape( word ) ) {
+                i += 8;
+                continue;
+            }
+        }
+        const unsigned char ch = data[i];
+        if( ch >= 0x20 && ch != '"' && ch != '\\' ) {
+            i++;
+            continue;
+        }
+        buffer.append( data + run_start, i - run_start );
         if( ch == '"' ) {
-            stream->write( "\\\"", 2 );
+            put( "\\\"" );
         } else if( ch == '\\' ) {
-            stream->write( "\\\\", 2 );
-        } else if( ch == '/' ) {
-            // don't technically need to escape this
-            stream->put( '/' );
+            put( "\\\\" );
         } else if( ch == '\b' ) {
-            stream->write( "\\b", 2 );
+            put( "\\b" );
         } else if( ch == '\f' ) {
-            stream->write( "\\f", 2 );
+            put( "\\f" );
         } else if( ch == '\n' ) {
-            stream->write( "\\n", 2 );
+            put( "\\n" );
         } else if( ch == '\r' ) {
-            stream->write( "\\r", 2 );
+            put( "\\r" );
         } else if( ch == '\t' ) {
-            stream->write( "\\t", 2 );
-        } else if( ch < 0x20 ) {
+            put( "\\t" );
+        } else {
             // convert to "\uxxxx" unicode escape
-            stream->write( "\\u00", 4 );
-            stream->put( ( ch < 0x10 ) ? '0' : '1' );
+            put( "\\u00" );
+            put( ( ch < 0x10 ) ? '0' : '1' );
             char remainder = ch & 0x0F;
             if( remainder < 0x0A ) {
-                stream->put( '0' + remainder );
+                put( static_cast<char>( '0' + remainder ) );
             } else {
-                stream->put( 'A' + ( remainder - 0x0A ) );
+                put( static_cast<char>( 'A' + ( remainder - 0x0A ) ) );
             }
-        } else {
-            stream->put( ch );
         }
+        i++;
+        run_start = i;
     }
-    stream->put( '"' );
+    buffer.append( data + run_start, size - run_start );
+    put( '"' );
     need_separator = true;
+    value_done();
 }
 
 template<size_t N>
@@ -2409,14 +2488,11 @@ void JsonOut::write( const std::bitset<N> &b )
     if( need_separator ) {
         write_separator();
     }
-    std::string converted = b.to_string();
-    stream->put( '"' );
-    for( char &i : converted ) {
-        unsigned char ch = i;
-        stream->put( ch );
-    }
-    stream->put( '"' );
+    put( '"' );
+    put( b.to_string() );
+    put( '"' );
     need_separator = true;
+    value_done();
 }
 
 void JsonOut::member( const std::string_view name )
@@ -4,14 +4,17 @@
 
 #include <array>
 #include <bitset>
+#include <charconv>
 #include <cstddef>
 #include <cstdint>
 #include <iostream>
 #include <iterator>
 #include <map>
+#include <memory>
 #include <set>
 #include <stdexcept>
 #include <string>
+#include <string_view>
 #include <type_traits>
 #include <utility>
 #include <vector>
@@ -729,6 +732,11 @@ class TextJsonIn
  * and the constructor also has an option for crude pretty-printing,
  * which inserts newlines and whitespace liberally, if turned on.
  *
+ * Output is collected in a buffer and handed to the stream in large chunks: whenever a top level
+ * value is complete, when the buffer grows large, and on destruction. So the stream is up to date
+ * between top level values, but not while an object or array is still open. Use get_stream(),
+ * which flushes, to write to the stream directly in that case.
+ *
  * Basic containers such as maps, sets and vectors,
  * can be serialized automatically by write() and member().
  */
@@ -740,11 +748,42 @@ class JsonOut
         std::vector<bool> need_wrap;
         int indent_level = 0;
         bool need_separator = false;
+        // Output not yet handed to the stream
+        std::string buffer;
+        // Formats floating point numbers the way the stream always did, created when needed
+        std::unique_ptr<std::ostringstream> float_stream;
+
+        void put( char ch ) {
+            buffer.push_back( ch );
+        }
+        void put( std::string_view s ) {
+            buffer.append( s );
+        }
+        template<typename T>
+        void put_integer( T val ) {
+            char digits[24];
+            const std::to_chars_result result = std::to_chars( std::begin( digits ), std::end( digits ),
+                                                val );
+            buffer.append( std::begin( digits ), result.ptr );
+        }
+        void put_float( double val );
+        // Called after each value: flushes if it was a top level one or the buffer is large
+        void value_done();
 
     public:
         explicit JsonOut( std::ostream &stream, bool pretty_print = false, int depth = 0 );
         JsonOut( const JsonOut & ) = delete;
         JsonOut &operator=( const JsonOut & ) = delete;
+        ~JsonOut();
+
+        /** Writes all buffered output to the stream. */
+        void flush();
+
+        /**
+         * Test hook: when disabled the buffer is flushed after every value, roughly like writing
+         * to the stream directly.
+         */
+        static void set_buffering_enabled( bool enabled );
 
         // punctuation
         void write_indent();
@@ -757,6 +796,7 @@ class JsonOut
             need_separator = true;
         }
         std::ostream *get_stream() {
+            flush();
             return stream;
         }
         int tell();
@@ -772,13 +812,25 @@ class JsonOut
         // write data to the output stream as JSON
         void write_null();
 
+        /** Writes text as it is, e.g. newlines to keep a file readable or already serialized JSON. */
+        void write_raw( std::string_view text ) {
+            put( text );
+        }
+
         template <typename T, std::enable_if_t<std::is_fundamental_v<T>, int> = 0>
         void write( T val ) {
             if( need_separator ) {
                 write_separator();
             }
-            *stream << val;
+            if constexpr( std::is_same_v<T, bool> ) {
+                put( val ? "true" : "false" );
+            } else if constexpr( std::is_integral_v<T> ) {
+                put_integer( val );
+            } else {
+                put_float( val );
+            }
             need_separator = true;
+            value_done();
         }
 
         /// Overload that calls a global function `serialize(const T&,JsonOut&)`, if available.
@@ -808,7 +860,7 @@ class JsonOut
         // strings need escaping and quoting
         void write( std::string_view val );
         void write( const char *val ) {
-            write( std::string( val ) );
+            write( std::string_view( val ) );
         }
 
         // char should always be written as an unquoted numeral
@@ -5,6 +5,7 @@
 #include <cmath>
 #include <cstdlib>
 #include <cstring>
+#include <limits>
 #include <map>
 #include <memory>
 #include <optional>
@@ -48,6 +49,7 @@
 #include "vpart_range.h"
 #include "weather.h"
 #include "weather_type.h"
+#include "worker_pool.h"
 
 static const efftype_id effect_haslight( "haslight" );
 static const efftype_id effect_onfire( "onfire" );
@@ -110,14 +112,16 @@ bool map::build_transparency_cache( const int zlev )
     }
 
     const float sight_penalty = get_weather().weather_id->sight_penalty;
+    // Submaps that are not loaded, reported once the workers are done
+    std::vector<char> missing( my_MAPSIZE * my_MAPSIZE, 0 );
 
-    // Traverse the submaps in order
-    for( int smx = 0; smx < my_MAPSIZE; ++smx ) {
+    // Submaps with the same x share the rows of transparent_cache_wo_fields, so each task
+    // builds a column of submaps and no two tasks write to the same row.
+    const auto build_column = [&]( const int smx ) {
         for( int smy = 0; smy < my_MAPSIZE; ++smy ) {
             const submap *cur_submap = get_submap_at_grid( {smx, smy, zlev} );
             if( cur_submap == nullptr ) {
-                debugmsg( "Tried to build transparency cache at (%d,%d,%d) but the submap is not loaded", smx, smy,
-                          zlev );
+                missing[smx * my_MAPSIZE + smy] = 1;
                 continue;
             }
 
@@ -187,6 +191,25 @@ bool map::build_transparency_cache( const int zlev )
                 }
             }
         }
+    };
+
+    worker_pool *const pool = get_shadowcasting_pool();
+    if( pool != nullptr ) {
+        pool->run( my_MAPSIZE, [&]( int smx, int ) {
+            build_column( smx );
+        } );
+    } else {
+        for( int smx = 0; smx < my_MAPSIZE; ++smx ) {
+            build_column( smx );
+        }
+    }
+    for( int smx = 0; smx < my_MAPSIZE; ++smx ) {
+        for( int smy = 0; smy < my_MAPSIZE; ++smy ) {
+            if( missing[smx * my_MAPSIZE + smy] ) {
+                debugmsg( "Tried to build transparency cache at (%d,%d,%d) but the submap is not loaded", smx, smy,
+                          zlev );
+            }
+        }
     }
     map_cache.transparency_cache_dirty.reset();
     return true;
@@ -615,11 +638,13 @@ void map::generate_lightmap( const int zlev )
     */
     const tripoint_bub_ms cache_start( 0, 0, zlev );
     const tripoint_bub_ms cache_end( LIGHTMAP_CACHE_X, LIGHTMAP_CACHE_Y, zlev );
+    std::vector<tripoint_bub_ms> buffered_sources;
     for( const tripoint_bub_ms &p : points_in_rectangle( cache_start, cache_end ) ) {
         if( light_source_buffer[p.x()][p.y()] > 0.0 ) {
-            apply_light_source( p, light_source_buffer[p.x()][p.y()] );
+            buffered_sources.push_back( p );
         }
     }
+    apply_buffered_light_sources( zlev, buffered_sources );
     for( const std::pair<tripoint_bub_ms, float> &elem : lm_override ) {
         lm[elem.first.x()][elem.first.y()].fill( elem.second );
     }
@@ -1192,8 +1217,71 @@ static bool light_check( const float &transparency, const float &intensity )
 void map::apply_light_source( const tripoint_bub_ms &p, float luminance )
 {
     level_cache &cache = get_cache( p.z() );
-    cata::mdarray<four_quadrants, point_bub_ms> &lm = cache.lm;
-    cata::mdarray<float, point_bub_ms> &sm = cache.sm;
+    apply_light_source( p, luminance, cache.lm, cache.sm );
+}
+
+void map::apply_buffered_light_sources( const int zlev, const std::vector<tripoint_bub_ms> &sources )
+{
+    level_cache &cache = get_cache( zlev );
+    const cata::mdarray<float, point_bub_ms> &light_source_buffer = cache.light_source_buffer;
+    worker_pool *const pool = get_shadowcasting_pool();
+    if( pool == nullptr || pool->size() == 1 || sources.size() < 2 ) {
+        for( const tripoint_bub_ms &p : sources ) {
+            apply_light_source( p, light_source_buffer[p.x()][p.y()] );
+        }
+        return;
+    }
+
+    // The sources only read the transparency and light source buffers and take the maximum of
+    // the old and new light, so each worker can light a buffer of its own and merging them by
+    // maximum gives the same result as applying the sources in order. Worker 0 lights the
+    // caches directly.
+    struct light_buffers {
+        cata::mdarray<four_quadrants, point_bub_ms> lm;
+        cata::mdarray<float, point_bub_ms> sm;
+    };
+    static std::vector<std::unique_ptr<light_buffers>> buffers;
+    const int workers = pool->size();
+    while( static_cast<int>( buffers.size() ) < workers - 1 ) {
+        buffers.emplace_back( std::make_unique<light_buffers>() );
+    }
+    // Only touched by the thread of the worker, so no synchronization needed
+    std::vector<char> used( workers, 0 );
+    constexpr float nothing = std::numeric_limits<float>::lowest();
+    pool->run( static_cast<int>( sources.size() ), [&]( int task, int worker ) {
+        const tripoint_bub_ms &p = sources[task];
+        const float luminance = light_source_buffer[p.x()][p.y()];
+        if( worker == 0 ) {
+            apply_light_source( p, luminance, cache.lm, cache.sm );
+            return;
+        }
+        light_buffers &buf = *buffers[worker - 1];
+        if( !used[worker] ) {
+            used[worker] = 1;
+            buf.lm.fill( four_quadrants( nothing ) );
+            buf.sm.fill( nothing );
+        }
+        apply_light_source( p, luminance, buf.lm, buf.sm );
+    } );
+    for( int worker = 1; worker < workers; worker++ ) {
+        if( !used[worker] ) {
+            continue;
+        }
+        const light_buffers &buf = *buffers[worker - 1];
+        for( int x = 0; x < LIGHTMAP_CACHE_X; x++ ) {
+            for( int y = 0; y < LIGHTMAP_CACHE_Y; y++ ) {
+                cache.lm[x][y] = elementwise_max( cache.lm[x][y], buf.lm[x][y] );
+                cache.sm[x][y] = std::max( cache.sm[x][y], buf.sm[x][y] );
+            }
+        }
+    }
+}
+
+void map::apply_light_source( const tripoint_bub_ms &p, float luminance,
+                              cata::mdarray<four_quadrants, point_bub_ms> &lm,
+                              cata::mdarray<float, point_bub_ms> &sm )
+{
+    level_cache &cache = get_cache( p.z() );
     cata::mdarray<float, point_bub_ms> &transparency_cache =
         cache.transparency_cache;
     cata::mdarray<float, point_bub_ms> &light_source_buffer =
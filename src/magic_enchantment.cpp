@@ -214,6 +214,19 @@ namespace io
 namespace
 {
 generic_factory<enchantment> spell_factory( "enchantment" );
+
+// Evaluates val, creating the dialogue for who only the first time a value is not a constant.
+template<typename T>
+double evaluate_for( const dbl_or_var &val, std::optional<dialogue> &d, const T &who )
+{
+    if( val.is_constant() ) {
+        return val.constant();
+    }
+    if( !d ) {
+        d.emplace( get_talker_for( who ), nullptr );
+    }
+    return val.evaluate( *d );
+}
 } // namespace
 
 template<>
@@ -686,27 +699,28 @@ void enchant_cache::force_add( const enchant_cache &rhs )
 
 void enchant_cache::force_add( const enchantment &rhs, const Character &guy )
 {
-    dialogue d( get_talker_for( guy ), nullptr );
+    // Most values are plain numbers, only set up a dialogue when one actually needs it.
+    std::optional<dialogue> d;
     for( const std::pair<const enchant_vals::mod, dbl_or_var> &pair_values :
          rhs.values_add ) {
-        values_add[pair_values.first] += pair_values.second.evaluate( d );
+        values_add[pair_values.first] += evaluate_for( pair_values.second, d, guy );
     }
     for( const std::pair<const enchant_vals::mod, dbl_or_var> &pair_values :
          rhs.values_multiply ) {
         // values do not multiply against each other, they add.
         // so +10% and -10% will add to 0%
-        values_multiply[pair_values.first] += pair_values.second.evaluate( d );
+        values_multiply[pair_values.first] += evaluate_for( pair_values.second, d, guy );
     }
 
     for( const std::pair<const skill_id, dbl_or_var> &pair_values :
          rhs.skill_values_add ) {
-        skill_values_add[pair_values.first] += pair_values.second.evaluate( d );
+        skill_values_add[pair_values.first] += evaluate_for( pair_values.second, d, guy );
     }
     for( const std::pair<const skill_id, dbl_or_var> &pair_values :
          rhs.skill_values_multiply ) {
         // values do not multiply against each other, they add.
         // so +10% and -10% will add to 0%
-        skill_values_multiply[pair_values.first] += pair_values.second.evaluate( d );
+        skill_values_multiply[pair_values.first] += evaluate_for( pair_values.second, d, guy );
     }
 
     hit_me_effect.insert( hit_me_effect.end(), rhs.hit_me_effect.begin(), rhs.hit_me_effect.end() );
@@ -739,27 +753,28 @@ void enchant_cache::force_add( const enchantment &rhs, const Character &guy )
 
 void enchant_cache::force_add( const enchantment &rhs, const monster &mon )
 {
-    dialogue d( get_talker_for( mon ), nullptr );
+    // Most values are plain numbers, only set up a dialogue when one actually needs it.
+    std::optional<dialogue> d;
     for( const std::pair<const enchant_vals::mod, dbl_or_var> &pair_values :
          rhs.values_add ) {
-        values_add[pair_values.first] += pair_values.second.evaluate( d );
+        values_add[pair_values.first] += evaluate_for( pair_values.second, d, mon );
     }
     for( const std::pair<const enchant_vals::mod, dbl_or_var> &pair_values :
          rhs.values_multiply ) {
         // values do not multiply against each other, they add.
         // so +10% and -10% will add to 0%
-        values_multiply[pair_values.first] += pair_values.second.evaluate( d );
+        values_multiply[pair_values.first] += evaluate_for( pair_values.second, d, mon );
     }
 
     for( const std::pair<const skill_id, dbl_or_var> &pair_values :
          rhs.skill_values_add ) {
-        skill_values_add[pair_values.first] += pair_values.second.evaluate( d );
+        skill_values_add[pair_values.first] += evaluate_for( pair_values.second, d, mon );
     }
     for( const std::pair<const skill_id, dbl_or_var> &pair_values :
          rhs.skill_values_multiply ) {
         // values do not multiply against each other, they add.
         // so +10% and -10% will add to 0%
-        skill_values_multiply[pair_values.first] += pair_values.second.evaluate( d );
+        skill_values_multiply[pair_values.first] += evaluate_for( pair_values.second, d, mon );
     }
 
     hit_me_effect.insert( hit_me_effect.end(), rhs.hit_me_effect.begin(), rhs.hit_me_effect.end() );
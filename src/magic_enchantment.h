@@ -286,6 +286,25 @@ class enchantment
         void add_activation( const time_duration &dur, const fake_spell &fake );
 };
 
+/**
+ * Enchantments granted to a Character by one kind of source (mutations, bionics or effects),
+ * kept until the sources or their active state change so recalculating the enchantment cache
+ * does not have to look every source up again.
+ */
+template<typename SourceId>
+struct enchantment_source_cache {
+    // the sources the entries were collected from, with whether each one was active
+    std::vector<std::pair<SourceId, bool>> sources;
+    // enchantments to add, in order, and whether their condition has to be checked on every use
+    std::vector<std::pair<enchantment_id, bool>> entries;
+
+    // Re-collects the entries if current_sources differs from the cached sources.
+    // Returns true if that was needed.
+    template<typename GetEnchantments>
+    bool update( const Character &guy, std::vector<std::pair<SourceId, bool>> &&current_sources,
+                 GetEnchantments &&get_enchantments );
+};
+
 class enchant_cache : public enchantment
 {
     public:
@@ -371,4 +390,27 @@ struct enum_traits<enchant_vals::mod> {
     static constexpr enchant_vals::mod last = enchant_vals::mod::NUM_MOD;
 };
 
+template<typename SourceId>
+template<typename GetEnchantments>
+bool enchantment_source_cache<SourceId>::update( const Character &guy,
+        std::vector<std::pair<SourceId, bool>> &&current_sources, GetEnchantments &&get_enchantments )
+{
+    if( current_sources == sources ) {
+        return false;
+    }
+    sources = std::move( current_sources );
+    entries.clear();
+    for( const std::pair<SourceId, bool> &source : sources ) {
+        for( const enchantment_id &ench_id : get_enchantments( source.first ) ) {
+            const enchantment &ench = ench_id.obj();
+            if( ench.active_conditions.second == enchantment::condition::DIALOG_CONDITION ) {
+                entries.emplace_back( ench_id, true );
+            } else if( ench.is_active( guy, source.second ) ) {
+                entries.emplace_back( ench_id, false );
+            }
+        }
+    }
+    return true;
+}
+
 #endif // CATA_SRC_MAGIC_ENCHANTMENT_H
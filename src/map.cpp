@@ -11,6 +11,7 @@
 #include <string>
 #include <type_traits>
 #include <unordered_map>
+#include <unordered_set>
 #include <utility>
 
 #include "active_item_cache.h"
@@ -35,6 +36,7 @@
 #include "coords_fwd.h"
 #include "creature.h"
 #include "creature_tracker.h"
+#include "creature_visibility.h"
 #include "cuboid_rectangle.h"
 #include "cursesdef.h"
 #include "damage.h"
@@ -263,13 +265,19 @@ map::map( int mapsize, bool zlev ) : my_MAPSIZE( mapsize ), my_HALF_MAPSIZE( map
     traplocs.resize( trap::count() );
 }
 
+// Brings the main map up to date after mapgen of another map placed things in it
+static void clean_up_main_map()
+{
+    get_map().reset_vehicles_sm_pos();
+    get_map().rebuild_vehicle_level_caches();
+    g->load_npcs();
+}
+
 map::~map()
 {
     if( ( _main_requires_cleanup && !_main_cleanup_override ) ||
         ( _main_cleanup_override && *_main_cleanup_override ) ) {
-        get_map().reset_vehicles_sm_pos();
-        get_map().rebuild_vehicle_level_caches();
-        g->load_npcs();
+        clean_up_main_map();
     }
 }
 // NOLINTNEXTLINE(performance-noexcept-move-constructor)
@@ -5369,6 +5377,7 @@ map_stack::iterator map::i_rem( const tripoint_bub_ms &p, const map_stack::const
     }
 
     current_submap->update_lum_rem( l, *it );
+    current_submap->invalidate_item_tiles();
 
     return current_submap->get_items( l ).erase( it );
 }
@@ -5403,6 +5412,7 @@ void map::i_clear( const tripoint_bub_ms &p )
 
     current_submap->set_lum( l, 0 );
     current_submap->get_items( l ).clear();
+    current_submap->invalidate_item_tiles();
 }
 
 std::vector<item *> map::spawn_items( const tripoint_bub_ms &p, const std::vector<item> &new_items )
@@ -5749,6 +5759,7 @@ item &map::add_item( const tripoint_bub_ms &p, item new_item, int copies )
     invalidate_max_populated_zlev( p.z() );
 
     current_submap->update_lum_add( l, new_item );
+    current_submap->invalidate_item_tiles();
 
     const map_stack::iterator new_pos = current_submap->get_items( l ).insert( new_item );
     while( --copies > 0 ) {
@@ -6243,6 +6254,33 @@ bool map::has_items( const tripoint_bub_ms &p ) const
     return !current_submap->get_items( l ).empty();
 }
 
+std::vector<tripoint_bub_ms> map::tiles_with_items( const tripoint_bub_ms &p, int range ) const
+{
+    std::vector<tripoint_bub_ms> ret;
+    if( !inbounds_z( p.z() ) ) {
+        return ret;
+    }
+    const point min( std::max( p.x() - range, 0 ), std::max( p.y() - range, 0 ) );
+    const point max( std::min( p.x() + range, SEEX * my_MAPSIZE - 1 ),
+                     std::min( p.y() + range, SEEY * my_MAPSIZE - 1 ) );
+    const inclusive_rectangle<point> area( min, max );
+    for( int smx = min.x / SEEX; smx <= max.x / SEEX; ++smx ) {
+        for( int smy = min.y / SEEY; smy <= max.y / SEEY; ++smy ) {
+            const submap *const current_submap = get_submap_at_grid( { smx, smy, p.z() } );
+            if( current_submap == nullptr ) {
+                continue;
+            }
+            for( const point_sm_ms &l : current_submap->get_item_tiles() ) {
+                const point pt( smx * SEEX + l.x(), smy * SEEY + l.y() );
+                if( area.contains( pt ) ) {
+                    ret.emplace_back( pt.x, pt.y, p.z() );
+                }
+            }
+        }
+    }
+    return ret;
+}
+
 bool map::only_liquid_in_liquidcont( const tripoint_bub_ms &p )
 {
     if( has_flag( ter_furn_flag::TFLAG_LIQUIDCONT, p ) ) {
@@ -8517,6 +8555,98 @@ shift_bitset_cache<MAPSIZE_X, SEEX>( std::bitset<MAPSIZE_X *MAPSIZE_X> &cache,
 template void
 shift_bitset_cache<MAPSIZE, 1>( std::bitset<MAPSIZE *MAPSIZE> &cache, const point &s );
 
+// Runs mapgen for the overmap terrain column at p and stores the result in the map buffer.
+// Returns whether the main map has to be cleaned up afterwards.
+static bool generate_omt_column( const tripoint_abs_omt &p )
+{
+    std::optional<rng_stream> column_rng;
+    std::optional<rng_stream_scope> isolated_rng;
+    if( speculative_mapgen ) {
+        // Keyed by location, so the result does not depend on whether the column was generated
+        // ahead of time or when the map reached it.
+        column_rng.emplace( rng_stream( g->get_seed() ).fork( p.xy().raw() ) );
+        isolated_rng.emplace( *column_rng );
+    }
+    smallmap tmp_map;
+    tmp_map.main_cleanup_override( false );
+    tmp_map.generate( p, calendar::turn, true );
+    return tmp_map.is_main_cleanup_queued();
+}
+
+std::vector<tripoint_abs_omt> map::quads_ahead( const point_rel_sm &direction, int distance,
+        bool all_z ) const
+{
+    std::vector<tripoint_abs_omt> quads;
+    const point step( clamp( direction.x(), -1, 1 ), clamp( direction.y(), -1, 1 ) );
+    if( step == point_zero ) {
+        return quads;
+    }
+    const tripoint_abs_sm origin = get_abs_sub();
+    const int zmin = all_z ? -OVERMAP_DEPTH : origin.z();
+    const int zmax = all_z ? OVERMAP_HEIGHT : origin.z();
+    std::unordered_set<tripoint_abs_omt> requested;
+    // Each further shift loads the submaps on the leading edges, nearest ones first
+    for( int i = 1; i <= distance; i++ ) {
+        const point_abs_sm shifted = origin.xy() + point_rel_sm( step * i );
+        for( int gridx = 0; gridx < my_MAPSIZE; gridx++ ) {
+            for( int gridy = 0; gridy < my_MAPSIZE; gridy++ ) {
+                const bool leading_x = ( step.x > 0 && gridx == my_MAPSIZE - 1 ) ||
+                                       ( step.x < 0 && gridx == 0 );
+                const bool leading_y = ( step.y > 0 && gridy == my_MAPSIZE - 1 ) ||
+                                       ( step.y < 0 && gridy == 0 );
+                if( !leading_x && !leading_y ) {
+                    continue;
+                }
+                for( int gridz = zmin; gridz <= zmax; gridz++ ) {
+                    const tripoint_abs_omt quad = project_to<coords::omt>(
+                                                      tripoint_abs_sm( shifted + point_rel_sm( gridx, gridy ), gridz ) );
+                    if( requested.insert( quad ).second ) {
+                        quads.push_back( quad );
+                    }
+                }
+            }
+        }
+    }
+    return quads;
+}
+
+void map::queue_mapgen_ahead( const std::vector<tripoint_abs_omt> &quads )
+{
+    mapgen_ahead.clear();
+    for( const tripoint_abs_omt &quad : quads ) {
+        if( !MAPBUFFER.quad_generated( quad ) ) {
+            mapgen_ahead.push_back( quad );
+        }
+    }
+}
+
+void map::generate_ahead( const std::chrono::microseconds &budget )
+{
+    const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    bool cleanup_queued = false;
+    while( !mapgen_ahead.empty() ) {
+        const tripoint_abs_omt quad = mapgen_ahead.front();
+        mapgen_ahead.pop_front();
+        // The map may have reached it already
+        if( MAPBUFFER.quad_generated( quad ) ) {
+            continue;
+        }
+        cleanup_queued |= generate_omt_column( quad );
+        if( std::chrono::steady_clock::now() - start >= budget ) {
+            break;
+        }
+    }
+    if( !cleanup_queued ) {
+        return;
+    }
+    if( this == &get_map() ) {
+        clean_up_main_map();
+    } else {
+        // Same as when shift() generates a column, cleaned up when this map goes away
+        queue_main_cleanup();
+    }
+}
+
 void map::shift( const point_rel_sm &sp )
 {
     if( !zlevels ) {
@@ -8754,10 +8884,8 @@ void map::loadn( const point &grid, bool update_vehicles )
     }
 
     if( map_incomplete ) {
-        smallmap tmp_map;
-        tmp_map.main_cleanup_override( false );
-        tmp_map.generate( grid_abs_omt, calendar::turn, true );
-        _main_requires_cleanup |= main_inbounds && tmp_map.is_main_cleanup_queued();
+        const bool cleanup_queued = generate_omt_column( grid_abs_omt );
+        _main_requires_cleanup |= main_inbounds && cleanup_queued;
 
         for( int gridz = -OVERMAP_DEPTH; gridz <= OVERMAP_HEIGHT; gridz++ ) {
             const tripoint_abs_sm pos = {grid_sm_base.xy(), gridz };
@@ -10229,6 +10357,7 @@ void map::build_map_cache( const int zlev, bool skip_lightmap )
     if( !skip_lightmap ) {
         generate_lightmap( zlev );
     }
+    get_creature_visibility_cache().clear();
 }
 
 //////////
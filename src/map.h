@@ -4,9 +4,11 @@
 
 #include <array>
 #include <bitset>
+#include <chrono>
 #include <climits>
 #include <cstddef>
 #include <cstdint>
+#include <deque>
 #include <functional>
 #include <iosfwd>
 #include <list>
@@ -541,6 +543,22 @@ class map
          * Note: the map must have been loaded before this can be called.
          */
         void shift( const point_rel_sm &s );
+        /**
+         * The quads this map would load if it kept shifting along direction for another
+         * distance submaps, nearest first. Only the current z-level unless all_z is set.
+         */
+        std::vector<tripoint_abs_omt> quads_ahead( const point_rel_sm &direction, int distance,
+                bool all_z ) const;
+        /**
+         * Replaces the quads to be generated by generate_ahead with those of quads that have
+         * not been generated yet.
+         */
+        void queue_mapgen_ahead( const std::vector<tripoint_abs_omt> &quads );
+        /**
+         * Generates queued quads until budget is used up, at least one if any is queued, so
+         * new terrain is generated a little at a time before the map shifts onto it.
+         */
+        void generate_ahead( const std::chrono::microseconds &budget );
         /**
          * Moves the map vertically to (not by!) newz.
          * Does not actually shift anything, only forces cache updates.
@@ -1138,6 +1156,12 @@ class map
         // TODO: fix point types (remove the first overload)
         bool has_items( const tripoint &p ) const;
         bool has_items( const tripoint_bub_ms &p ) const;
+        /**
+         * Tiles on the z-level of p within range of it (square distance) that hold items, in no
+         * particular order. Uses the per-submap index of tiles with items, so it is much cheaper
+         * than checking every tile of the area.
+         */
+        std::vector<tripoint_bub_ms> tiles_with_items( const tripoint_bub_ms &p, int range ) const;
 
         // Check if a tile with LIQUIDCONT flag only contains liquids
         bool only_liquid_in_liquidcont( const tripoint_bub_ms &p );
@@ -2338,6 +2362,8 @@ class map
         int my_MAPSIZE;
         int my_HALF_MAPSIZE;
         bool zlevels;
+        // Quads generate_ahead will generate, nearest first
+        std::deque<tripoint_abs_omt> mapgen_ahead; // NOLINT(cata-serialize)
 
         /**
          * Absolute coordinates of first submap (get_submap_at(0,0))
@@ -2504,6 +2530,12 @@ class map
         int determine_wall_corner( const tripoint &p ) const;
         // apply a circular light pattern immediately, however it's best to use...
         void apply_light_source( const tripoint_bub_ms &p, float luminance );
+        // the same, writing the light into lm and sm instead of the caches of the z-level
+        void apply_light_source( const tripoint_bub_ms &p, float luminance,
+                                 cata::mdarray<four_quadrants, point_bub_ms> &lm,
+                                 cata::mdarray<float, point_bub_ms> &sm );
+        // applies the buffered light sources at the given points, on the shadowcasting pool if set
+        void apply_buffered_light_sources( int zlev, const std::vector<tripoint_bub_ms> &sources );
         // ...this, which will apply the light after at the end of generate_lightmap, and prevent redundant
         // light rays from causing massive slowdowns, if there's a huge amount of light.
         void add_light_source( const tripoint_bub_ms &p, float luminance );
@@ -1,17 +1,28 @@
 #include "mapbuffer.h"
 
 #include <chrono>
+#include <condition_variable>
+#include <deque>
 #include <exception>
 #include <filesystem>
+#include <map>
+#include <mutex>
 #include <set>
 #include <sstream>
 #include <string>
+#include <thread>
 #include <utility>
 #include <vector>
 
+#if defined(_WIN32) && !defined(_MSC_VER)
+#   include "mingw.thread.h"
+#endif
+
 #include "cata_utility.h"
 #include "debug.h"
 #include "filesystem.h"
+#include "flexbuffer_cache.h"
+#include "flexbuffer_json.h"
 #include "input.h"
 #include "json.h"
 #include "map.h"
@@ -45,6 +56,136 @@ static cata_path find_dirname( const tripoint_abs_omt &om_addr )
             segment_addr.y(), segment_addr.z() );
 }
 
+/**
+ * Reads and parses quad files on a background thread into a staging area, from which
+ * mapbuffer::unserialize_submaps takes them. Only the JSON parsing happens on the thread,
+ * building the submaps touches game data and stays on the main thread.
+ */
+class quad_prefetcher
+{
+    public:
+        quad_prefetcher() : thread( &quad_prefetcher::work, this ) {}
+        ~quad_prefetcher() {
+            {
+                std::lock_guard<std::mutex> lock( mutex );
+                stopping = true;
+            }
+            wake.notify_all();
+            thread.join();
+        }
+
+        void request( const tripoint_abs_omt &quad, fs::path path ) {
+            {
+                std::lock_guard<std::mutex> lock( mutex );
+                if( staged.count( quad ) || !queued.insert( quad ).second ) {
+                    return;
+                }
+                queue.emplace_back( quad, std::move( path ) );
+                // Requests for places we have driven away from are the least useful ones
+                while( queue.size() > max_queued ) {
+                    queued.erase( queue.front().first );
+                    queue.pop_front();
+                }
+            }
+            wake.notify_one();
+        }
+
+        std::shared_ptr<parsed_flexbuffer> take( const tripoint_abs_omt &quad ) {
+            std::lock_guard<std::mutex> lock( mutex );
+            const auto it = staged.find( quad );
+            if( it == staged.end() ) {
+                return nullptr;
+            }
+            std::shared_ptr<parsed_flexbuffer> result = std::move( it->second );
+            staged.erase( it );
+            return result;
+        }
+
+        // The file of the quad was written, anything read before is outdated
+        void invalidate( const tripoint_abs_omt &quad ) {
+            std::lock_guard<std::mutex> lock( mutex );
+            staged.erase( quad );
+            epoch++;
+        }
+
+        void clear() {
+            std::lock_guard<std::mutex> lock( mutex );
+            queue.clear();
+            queued.clear();
+            staged.clear();
+            staged_order.clear();
+            epoch++;
+        }
+
+        void wait_until_idle() {
+            std::unique_lock<std::mutex> lock( mutex );
+            idle.wait( lock, [this]() {
+                return queue.empty() && !busy;
+            } );
+        }
+
+    private:
+        static constexpr size_t max_queued = 512;
+        static constexpr size_t max_staged = 256;
+
+        void work() {
+            std::unique_lock<std::mutex> lock( mutex );
+            while( true ) {
+                wake.wait( lock, [this]() {
+                    return stopping || !queue.empty();
+                } );
+                if( stopping ) {
+                    return;
+                }
+                const tripoint_abs_omt quad = queue.front().first;
+                const fs::path path = std::move( queue.front().second );
+                queue.pop_front();
+                queued.erase( quad );
+                const unsigned started = epoch;
+                busy = true;
+                lock.unlock();
+
+                std::shared_ptr<parsed_flexbuffer> buffer;
+                try {
+                    if( file_exist( path ) ) {
+                        buffer = flexbuffer_cache::parse( path );
+                    }
+                } catch( const std::exception & ) {
+                    // Leave it to the regular load, which reports the error
+                }
+
+                lock.lock();
+                busy = false;
+                if( buffer && epoch == started ) {
+                    staged[quad] = std::move( buffer );
+                    staged_order.push_back( quad );
+                    while( staged_order.size() > max_staged ) {
+                        staged.erase( staged_order.front() );
+                        staged_order.pop_front();
+                    }
+                }
+                if( queue.empty() ) {
+                    idle.notify_all();
+                }
+            }
+        }
+
+        std::mutex mutex;
+        std::condition_variable wake;
+        std::condition_variable idle;
+        std::deque<std::pair<tripoint_abs_omt, fs::path>> queue;
+        std::set<tripoint_abs_omt> queued;
+        std::map<tripoint_abs_omt, std::shared_ptr<parsed_flexbuffer>> staged;
+        // Order in which quads were staged, may contain quads that were taken already
+        std::deque<tripoint_abs_omt> staged_order;
+        // Incremented whenever staged data may have become outdated
+        unsigned epoch = 0;
+        bool busy = false;
+        bool stopping = false;
+        // Last member, so everything above exists when the thread starts
+        std::thread thread;
+};
+
 mapbuffer MAPBUFFER;
 
 mapbuffer::mapbuffer() = default;
@@ -53,6 +194,35 @@ mapbuffer::~mapbuffer() = default;
 void mapbuffer::clear()
 {
     submaps.clear();
+    if( prefetcher ) {
+        prefetcher->clear();
+    }
+}
+
+bool mapbuffer::quad_generated( const tripoint_abs_omt &quad ) const
+{
+    return submaps.count( project_to<coords::sm>( quad ) ) ||
+           file_exist( find_quad_path( find_dirname( quad ), quad ) );
+}
+
+void mapbuffer::prefetch( const std::vector<tripoint_abs_omt> &quads )
+{
+    if( !prefetcher ) {
+        prefetcher = std::make_unique<quad_prefetcher>();
+    }
+    for( const tripoint_abs_omt &quad : quads ) {
+        if( submaps.count( project_to<coords::sm>( quad ) ) ) {
+            continue;
+        }
+        prefetcher->request( quad, find_quad_path( find_dirname( quad ), quad ).get_unrelative_path() );
+    }
+}
+
+void mapbuffer::wait_for_prefetch()
+{
+    if( prefetcher ) {
+        prefetcher->wait_until_idle();
+    }
 }
 
 void mapbuffer::clear_outside_reality_bubble()
@@ -277,6 +447,9 @@ void mapbuffer::save_quad(
     if( all_uniform && reverted_to_uniform ) {
         fs::remove( filename.get_unrelative_path() );
     }
+    if( prefetcher ) {
+        prefetcher->invalidate( om_addr );
+    }
 }
 
 // We're reading in way too many entities here to mess around with creating sub-objects and
@@ -302,7 +475,33 @@ submap *mapbuffer::unserialize_submaps( const tripoint_abs_sm &p )
         }
     }
 
-    if( !read_from_file_optional_json( quad_path, [this]( const JsonValue & jsin ) {
+    bool loaded = false;
+    std::shared_ptr<parsed_flexbuffer> prefetched = prefetcher ? prefetcher->take( om_addr ) : nullptr;
+    if( prefetched ) {
+        // Submaps of the quad that are not loaded yet, deserialize may add them
+        std::vector<tripoint_abs_sm> not_loaded;
+        const tripoint_abs_sm quad_origin = project_to<coords::sm>( om_addr );
+        for( const point &offset : { point_zero, point_east, point_south, point_south_east } ) {
+            if( !submaps.count( quad_origin + offset ) ) {
+                not_loaded.emplace_back( quad_origin + offset );
+            }
+        }
+        try {
+            const flexbuffers::Reference root = flexbuffer_root_from_storage( prefetched->get_storage() );
+            // The buffer keeps the path of the quad file for error messages
+            deserialize( JsonValue( std::move( prefetched ), root, nullptr, 0 ) );
+            prefetch_hits++;
+            loaded = true;
+        } catch( const std::exception &err ) {
+            debugmsg( "Failed to read prefetched \"%1$s\": %2$s", quad_path.generic_u8string(),
+                      err.what() );
+            // Drop whatever was read before the error, the file is read again below
+            for( const tripoint_abs_sm &sm_addr : not_loaded ) {
+                submaps.erase( sm_addr );
+            }
+        }
+    }
+    if( !loaded && !read_from_file_optional_json( quad_path, [this]( const JsonValue & jsin ) {
     deserialize( jsin );
     } ) ) {
         // If it doesn't exist, trigger generating it.
@@ -6,12 +6,14 @@
 #include <list>
 #include <map>
 #include <memory>
+#include <vector>
 
 #include "coords_fwd.h"
 #include "point.h"
 
 class cata_path;
 class JsonArray;
+class quad_prefetcher;
 class submap;
 
 /**
@@ -65,6 +67,26 @@ class mapbuffer
         // Cheaper version of the above for when you only care about whether the
         // submap exists or not.
         bool submap_exists( const tripoint_abs_sm &p );
+        /**
+         * Whether the quad has been generated, i.e. its submaps are loaded or it has a save file.
+         * Unlike submap_exists this never loads anything. Quads of uniform terrain are not written
+         * to disk, so they count as not generated again once unloaded.
+         */
+        bool quad_generated( const tripoint_abs_omt &quad ) const;
+
+        /**
+         * Starts reading and parsing the save files of the given overmap terrain quads on a
+         * background thread. A later lookup_submap of one of their submaps then only has to
+         * build the submaps from the parsed data. Quads that are already loaded, or that have
+         * no file because they have not been generated yet, are ignored.
+         */
+        void prefetch( const std::vector<tripoint_abs_omt> &quads );
+        /** Test hook: waits until the background thread has handled every requested quad. */
+        void wait_for_prefetch();
+        /** Number of quads loaded from prefetched data so far. */
+        int get_prefetch_hits() const {
+            return prefetch_hits;
+        }
 
     private:
         using submap_map_t = std::map<tripoint_abs_sm, std::unique_ptr<submap>>;
@@ -88,6 +110,8 @@ class mapbuffer
             const tripoint_abs_omt &om_addr, std::list<tripoint_abs_sm> &submaps_to_delete,
             bool delete_after_save );
         submap_map_t submaps; // NOLINT(cata-serialize)
+        std::unique_ptr<quad_prefetcher> prefetcher; // NOLINT(cata-serialize)
+        int prefetch_hits = 0; // NOLINT(cata-serialize)
 };
 
 extern mapbuffer MAPBUFFER;
@@ -92,6 +92,8 @@ static const ter_str_id ter_t_pit( "t_pit" );
 static const ter_str_id ter_t_pit_glass( "t_pit_glass" );
 static const ter_str_id ter_t_pit_spiked( "t_pit_spiked" );
 
+static const option_handle<bool> option_LOG_MONSTER_MOVEMENT( "LOG_MONSTER_MOVEMENT" );
+
 bool monster::is_immune_field( const field_type_id &fid ) const
 {
     if( fid == fd_fungal_haze ) {
@@ -1822,7 +1824,7 @@ bool monster::move_to( const tripoint &p, bool force, bool step_on_critter,
             if( flies() ) {
                 mod_moves( -get_speed() );
                 force = true;
-                if( get_option<bool>( "LOG_MONSTER_MOVEMENT" ) ) {
+                if( option_LOG_MONSTER_MOVEMENT.get() ) {
                     add_msg_if_player_sees( *this, _( "The %1$s flies over the %2$s." ), name(),
                                             here.has_flag_furn( ter_furn_flag::TFLAG_CLIMBABLE, p ) ? here.furnname( p ) :
                                             here.tername( p ) );
@@ -1830,7 +1832,7 @@ bool monster::move_to( const tripoint &p, bool force, bool step_on_critter,
             } else if( climbs() ) {
                 mod_moves( -get_speed() * 1.5 );
                 force = true;
-                if( get_option<bool>( "LOG_MONSTER_MOVEMENT" ) ) {
+                if( option_LOG_MONSTER_MOVEMENT.get() ) {
                     add_msg_if_player_sees( *this, _( "The %1$s climbs over the %2$s." ), name(),
                                             here.has_flag_furn( ter_furn_flag::TFLAG_CLIMBABLE, p ) ? here.furnname( p ) :
                                             here.tername( p ) );
@@ -1873,7 +1875,7 @@ bool monster::move_to( const tripoint &p, bool force, bool step_on_critter,
             has_flag( mon_flag_AQUATIC ) || ( can_submerge() && !here.veh_at( destination ) )
         ) && here.is_divable( destination );
 
-    if( get_option<bool>( "LOG_MONSTER_MOVEMENT" ) ) {
+    if( option_LOG_MONSTER_MOVEMENT.get() ) {
         //Birds and other flying creatures flying over the deep water terrain
         if( was_water && flies() ) {
             if( one_in( 4 ) ) {
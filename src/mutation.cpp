@@ -137,7 +137,7 @@ bool Character::has_trait_flag( const json_character_flag &b ) const
     // UGLY, SLOW, should be cached as my_mutation_flags or something
     for( const trait_id &mut : get_mutations() ) {
         const mutation_branch &mut_data = mut.obj();
-        if( mut_data.flags.count( b ) > 0 ) {
+        if( mut_data.flag_bits.contains( mut_data.flags, b ) ) {
             return true;
         } else if( mut_data.activated ) {
             Character &player = get_player_character();
@@ -157,7 +157,7 @@ int Character::count_trait_flag( const json_character_flag &b ) const
     // UGLY, SLOW, should be cached as my_mutation_flags or something
     for( const trait_id &mut : get_mutations() ) {
         const mutation_branch &mut_data = mut.obj();
-        if( mut_data.flags.count( b ) > 0 ) {
+        if( mut_data.flag_bits.contains( mut_data.flags, b ) ) {
             ret++;
         } else if( mut_data.activated ) {
             Character &player = get_player_character();
@@ -16,6 +16,8 @@
 #include "calendar.h"
 #include "character.h"
 #include "damage.h"
+#include "flag.h"
+#include "flat_id_map.h"
 #include "hash_utils.h"
 #include "memory_fast.h"
 #include "point.h"
@@ -329,9 +331,10 @@ struct mutation_branch {
         std::vector<trait_id> replacements; // Mutations that replace this one
         std::vector<trait_id> additions; // Mutations that add to this one
         std::vector<mutation_category_id> category; // Mutation Categories
-        std::set<json_character_flag> flags; // Mutation flags
-        std::set<json_character_flag> active_flags; // Mutation flags only when active
-        std::set<json_character_flag> inactive_flags; // Mutation flags only when inactive
+        cata::flat_id_set<json_character_flag> flags; // Mutation flags
+        flag_bitset flag_bits; // Bits of flags, built in finalize()
+        cata::flat_id_set<json_character_flag> active_flags; // Mutation flags only when active
+        cata::flat_id_set<json_character_flag> inactive_flags; // Mutation flags only when inactive
         std::map<bodypart_str_id, tripoint> protection; // Mutation wet effects
         std::map<bodypart_str_id, int> encumbrance_always; // Mutation encumbrance that always applies
         // Mutation encumbrance that applies when covered with unfitting item
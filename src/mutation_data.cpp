@@ -961,6 +961,7 @@ const trait_replacement &mutation_branch::trait_migration( const trait_id &tid )
 
 void mutation_branch::finalize()
 {
+    flag_bits.assign( flags );
     for( auto &armr : armor ) {
         finalize_damage_map( armr.second.resist_vals );
     }
@@ -550,6 +550,8 @@ struct npc_short_term_cache {
     // Use weak_ptr to avoid circular references between Creatures
     // attitude of creatures the npc can see
     std::vector<weak_ptr_fast<Creature>> hostile_guys;
+    // hostile characters with the threat assess_danger() rated them at
+    std::vector<std::pair<weak_ptr_fast<Creature>, float>> hostile_character_threats;
     std::vector<weak_ptr_fast<Creature>> neutral_guys;
     std::vector<weak_ptr_fast<Creature>> friends;
     std::vector<sphere> dangerous_explosives;
@@ -1085,6 +1087,8 @@ class npc : public Character
 
         /** rates how dangerous a target is */
         float evaluate_monster( const monster &target, int dist ) const;
+        /** Distance-scaled threat of the hostile characters rated by assess_danger(), seen from p. */
+        float hostile_character_danger_at( const tripoint_abs_ms &p ) const;
         float evaluate_character( const Character &candidate, bool my_gun, bool enemy );
         float evaluate_self( bool my_gun );
 
@@ -0,0 +1,97 @@
+#include "npc_threat.h"
+
+#include <algorithm>
+
+#include "creature.h"
+#include "game.h"
+#include "line.h"
+#include "monster.h"
+#include "mtype.h"
+#include "npc.h"
+
+static bool threat_field_enabled = true;
+
+npc_threat_field &get_npc_threat_field()
+{
+    static npc_threat_field field;
+    return field;
+}
+
+void npc_threat_field::set_enabled( bool enabled )
+{
+    threat_field_enabled = enabled;
+    npc_threat_field &field = get_npc_threat_field();
+    field.cached_turn = calendar::before_time_starts;
+    field.factions.clear();
+}
+
+bool npc_threat_field::is_enabled()
+{
+    return threat_field_enabled;
+}
+
+void npc_threat_field::validate_turn()
+{
+    if( cached_turn != calendar::turn ) {
+        factions.clear();
+        cached_turn = calendar::turn;
+        stats.rebuilds++;
+    }
+}
+
+npc_threat_field::monster_threat npc_threat_field::get_monster_threat( const monster &critter )
+{
+    monster_threat threat;
+    threat.hp_percent = static_cast<float>( critter.get_hp() ) / critter.get_hp_max();
+    threat.difficulty = std::max( static_cast<float>( critter.type->difficulty ),
+                                  NPC_DANGER_VERY_LOW );
+    threat.speed_rating = critter.speed_rating();
+    return threat;
+}
+
+float npc_threat_field::scale_by_distance( const monster_threat &threat, int dist )
+{
+    const float scaled_distance = std::max( 1.0f, dist * dist / ( threat.speed_rating * 250.0f ) );
+    // Note that the danger can pass below "very low" if the monster is weak and far away.
+    const float diff = threat.difficulty * ( ( threat.hp_percent * 0.5f + 0.5f ) / scaled_distance );
+    return std::min( diff, NPC_MONSTER_DANGER_MAX );
+}
+
+npc_threat_field::faction_threats &npc_threat_field::get_faction_threats( const npc &guy )
+{
+    validate_turn();
+    const auto iter = factions.find( guy.get_fac_id() );
+    if( threat_field_enabled && iter != factions.end() ) {
+        return iter->second;
+    }
+    faction_threats &threats = factions[guy.get_fac_id()];
+    threats = faction_threats();
+    for( const monster &critter : g->all_monsters() ) {
+        if( critter.attitude_to( guy ) != Creature::Attitude::HOSTILE ) {
+            continue;
+        }
+        threats.hostiles.emplace_back( critter.get_location(), get_monster_threat( critter ) );
+    }
+    return threats;
+}
+
+float npc_threat_field::danger_at( const npc &guy, const tripoint_abs_ms &p )
+{
+    // Characters are rated by each NPC on its own (with some randomness), so they are not shared
+    const float character_danger = guy.hostile_character_danger_at( p );
+    faction_threats &threats = get_faction_threats( guy );
+    const auto iter = threats.danger.find( p );
+    if( iter != threats.danger.end() ) {
+        stats.hits++;
+        return iter->second + character_danger;
+    }
+    stats.misses++;
+    float danger = 0.0f;
+    for( const std::pair<tripoint_abs_ms, monster_threat> &hostile : threats.hostiles ) {
+        danger += scale_by_distance( hostile.second, rl_dist( p, hostile.first ) );
+    }
+    if( threat_field_enabled ) {
+        threats.danger.emplace( p, danger );
+    }
+    return danger + character_danger;
+}
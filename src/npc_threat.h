@@ -0,0 +1,86 @@
+#pragma once
+#ifndef CATA_SRC_NPC_THREAT_H
+#define CATA_SRC_NPC_THREAT_H
+
+#include <map>
+#include <utility>
+#include <vector>
+
+#include "calendar.h"
+#include "coordinates.h"
+#include "type_id.h"
+
+class monster;
+class npc;
+
+/**
+ * Per-turn summary of the monster threats around the reality bubble, shared by all NPCs.
+ *
+ * Per faction it keeps the hostile monsters with their distance independent threat, taken
+ * once per turn, and the danger of every tile some NPC of the faction asked about, so a large
+ * group of followers looking for a retreat spot rates each tile once instead of once per NPC.
+ * The whole field is dropped when the turn changes.
+ */
+class npc_threat_field
+{
+    public:
+        struct monster_threat {
+            // Monster difficulty, at least NPC_DANGER_VERY_LOW
+            float difficulty = 0.0f;
+            float hp_percent = 1.0f;
+            float speed_rating = 1.0f;
+        };
+
+        struct counters {
+            int hits = 0;
+            int misses = 0;
+            int rebuilds = 0;
+        };
+
+        /** Distance independent threat of a monster. */
+        static monster_threat get_monster_threat( const monster &critter );
+        /**
+         * Scales a monster threat by distance the same way npc::evaluate_monster does.
+         */
+        static float scale_by_distance( const monster_threat &threat, int dist );
+
+        /**
+         * Sum of the distance-scaled threats of all monsters hostile to guy's faction, as seen
+         * from p, plus the hostile characters guy rated in its last npc::assess_danger().
+         * Line of sight is not considered, and the set of hostile monsters is taken once per
+         * turn from the first NPC of the faction that asks.
+         */
+        float danger_at( const npc &guy, const tripoint_abs_ms &p );
+
+        const counters &get_counters() const {
+            return stats;
+        }
+        void reset_counters() {
+            stats = counters();
+        }
+
+        /**
+         * Test hook: when disabled every query is evaluated from scratch and nothing is cached.
+         * Setting it drops everything cached so far.
+         */
+        static void set_enabled( bool enabled );
+        static bool is_enabled();
+
+    private:
+        struct faction_threats {
+            // Hostile monster positions with their distance independent threat
+            std::vector<std::pair<tripoint_abs_ms, monster_threat>> hostiles;
+            std::map<tripoint_abs_ms, float> danger;
+        };
+
+        void validate_turn();
+        faction_threats &get_faction_threats( const npc &guy );
+
+        time_point cached_turn = calendar::before_time_starts;
+        std::map<faction_id, faction_threats> factions;
+        counters stats;
+};
+
+npc_threat_field &get_npc_threat_field();
+
+#endif // CATA_SRC_NPC_THREAT_H
@@ -10,6 +10,7 @@
 #include <numeric>
 #include <ostream>
 #include <tuple>
+#include <unordered_set>
 
 #include "active_item_cache.h"
 #include "activity_handlers.h"
@@ -58,6 +59,7 @@
 #include "monster.h"
 #include "mtype.h"
 #include "npc_attack.h"
+#include "npc_threat.h"
 #include "npctalk.h"
 #include "omdata.h"
 #include "options.h"
@@ -388,6 +390,23 @@ tripoint_bub_ms npc::good_escape_direction( bool include_pos )
         num_points_searched += 1;
     }
     ( void )num_points_searched;
+    if( candidates.size() > 1 ) {
+        // Break ties with the shared threat field: prefer the spots furthest from trouble
+        npc_threat_field &threats = get_npc_threat_field();
+        std::vector<float> dangers;
+        dangers.reserve( candidates.size() );
+        for( const tripoint_bub_ms &pt : candidates ) {
+            dangers.emplace_back( threats.danger_at( *this, here.getglobal( pt ) ) );
+        }
+        const float least_danger = *std::min_element( dangers.begin(), dangers.end() );
+        std::vector<tripoint_bub_ms> safest;
+        for( size_t i = 0; i < candidates.size(); i++ ) {
+            if( dangers[i] <= least_danger ) {
+                safest.emplace_back( candidates[i] );
+            }
+        }
+        candidates = std::move( safest );
+    }
     tripoint_bub_ms redirect_goal = random_entry( candidates );
     add_msg_debug( debugmode::DF_NPC_MOVEAI, "%s is repositioning to %s", name,
                    redirect_goal.to_string_writable() );
@@ -460,19 +479,33 @@ std::vector<sphere> npc::find_dangerous_explosives() const
 
 float npc::evaluate_monster( const monster &target, int dist ) const
 {
-    float speed = target.speed_rating();
-    float scaled_distance = std::max( 1.0f, dist * dist / ( speed * 250.0f ) );
-    float hp_percent = static_cast<float>( target.get_hp() ) / target.get_hp_max();
-    float diff = std::max( static_cast<float>( target.type->difficulty ), NPC_DANGER_VERY_LOW );
+    const npc_threat_field::monster_threat threat = npc_threat_field::get_monster_threat( target );
     add_msg_debug( debugmode::DF_NPC_COMBATAI,
                    "<color_yellow>evaluate_monster </color><color_dark_gray>%s thinks %s threat level is <color_light_gray>%1.2f</color><color_dark_gray> before considering situation.  Speed rating: %1.2f; dist: %i; scaled_distance: %1.0f; HP: %1.0f%%</color>",
-                   name, target.type->nname(), diff, speed, dist, scaled_distance, hp_percent * 100 );
-    // Note that the danger can pass below "very low" if the monster is weak and far away.
-    diff *= ( hp_percent * 0.5f + 0.5f ) / scaled_distance;
+                   name, target.type->nname(), threat.difficulty, threat.speed_rating, dist,
+                   std::max( 1.0f, dist * dist / ( threat.speed_rating * 250.0f ) ),
+                   threat.hp_percent * 100 );
+    const float diff = npc_threat_field::scale_by_distance( threat, dist );
     add_msg_debug( debugmode::DF_NPC_COMBATAI,
                    "<color_light_gray>%s puts final %s threat level at </color>%1.2f<color_light_gray> after counting speed, distance, hp</color>",
                    name, target.type->nname(), diff );
-    return std::min( diff, NPC_MONSTER_DANGER_MAX );
+    return diff;
+}
+
+float npc::hostile_character_danger_at( const tripoint_abs_ms &p ) const
+{
+    float danger = 0.0f;
+    for( const std::pair<weak_ptr_fast<Creature>, float> &hostile :
+         ai_cache.hostile_character_threats ) {
+        const shared_ptr_fast<Creature> foe = hostile.first.lock();
+        if( !foe ) {
+            continue;
+        }
+        // Same scaling as assess_danger() uses for the total danger
+        const int dist = rl_dist( p, foe->get_location() );
+        danger += hostile.second / std::max( 1, ( 100 * dist ) / foe->get_speed() );
+    }
+    return danger;
 }
 
 float npc::evaluate_character( const Character &candidate, bool my_gun, bool enemy = true )
@@ -941,6 +974,7 @@ void npc::assess_danger()
 
         int scaled_distance = std::max( 1, ( 100 * dist ) / foe.get_speed() );
         ai_cache.total_danger += foe_threat / scaled_distance;
+        ai_cache.hostile_character_threats.emplace_back( g->shared_from( foe ), foe_threat );
         if( must_retreat || no_fighting ) {
             return 0.0f;
         }
@@ -1237,6 +1271,7 @@ void npc::regen_ai_cache()
     float old_assessment = ai_cache.danger_assessment;
     ai_cache.friends.clear();
     ai_cache.hostile_guys.clear();
+    ai_cache.hostile_character_threats.clear();
     ai_cache.neutral_guys.clear();
     ai_cache.target = shared_ptr_fast<Creature>();
     ai_cache.ally = shared_ptr_fast<Creature>();
@@ -3543,7 +3578,20 @@ void npc::find_item()
         }
     };
 
+    // Without a whitelist only tiles with items or vehicles can have something to pick up, so
+    // all others are skipped. With one, plants to harvest have to be checked on every tile.
+    const bool check_every_tile = has_item_whitelist();
+    std::unordered_set<tripoint_bub_ms> item_tiles;
+    if( !check_every_tile ) {
+        for( const tripoint_bub_ms &p : here.tiles_with_items( pos_bub(), range ) ) {
+            item_tiles.insert( p );
+        }
+    }
+
     for( const tripoint_bub_ms &p : closest_points_first( pos_bub(), range ) ) {
+        if( !check_every_tile && !item_tiles.count( p ) && !here.veh_at( p ) ) {
+            continue;
+        }
         // TODO: Make this sight check not overdraw nearby tiles
         // TODO: Optimize that zone check
         if( is_player_ally() && g->check_zone( zone_type_NO_NPC_PICKUP, p.raw() ) ) {
@@ -5419,4 +5467,5 @@ void npc::set_movement_mode( const move_mode_id &new_mode )
     // Enchantments based on move modes can stack inappropriately without a recalc here
     recalculate_enchantment_cache();
     move_mode = new_mode;
+    visibility_revision++;
 }
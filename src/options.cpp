@@ -29,6 +29,7 @@
 #include "popup.h"
 #include "sdltiles.h" // IWYU pragma: keep
 #include "sdlsound.h"
+#include "shadowcasting.h"
 #include "sounds.h"
 #include "string_formatter.h"
 #include "string_input_popup.h"
@@ -36,6 +37,7 @@
 #include "translations.h"
 #include "try_parse_integer.h"
 #include "ui_manager.h"
+#include "worker_pool.h"
 #include "worldfactory.h"
 
 #if defined(TILES)
@@ -205,6 +207,19 @@ options_manager &get_options()
     return single_instance;
 }
 
+unsigned int options_manager::values_revision = 1;
+
+option_handle_base::option_handle_base( const std::string &name ) : name( name )
+{
+    registered_names().push_back( name );
+}
+
+std::vector<std::string> &option_handle_base::registered_names()
+{
+    static std::vector<std::string> names;
+    return names;
+}
+
 options_manager::options_manager()
 {
     pages_.emplace_back( "general", to_translation( "General" ) );
@@ -267,6 +282,7 @@ void options_manager::add_value( const std::string &lvar, const std::string &lva
 
 void options_manager::addOptionToPage( const std::string &name, const std::string &page )
 {
+    values_revision++;
     Page &p = find_page( page );
     // Don't add duplicate options to the page
     for( const PageItem &i : p.items_ ) {
@@ -343,6 +359,7 @@ void options_manager::add_external( const std::string &sNameIn, const std::strin
 
     thisOpt.hide = COPT_ALWAYS_HIDE;
     options[sNameIn] = thisOpt;
+    values_revision++;
 }
 
 //add string select option
@@ -958,6 +975,7 @@ int options_manager::cOpt::getMaxLength() const
 //set to next item
 void options_manager::cOpt::setNext()
 {
+    values_revision++;
     if( sType == "string_select" ) {
         int iNext = getItemPos( sSet ) + 1;
         if( iNext >= static_cast<int>( vItems.size() ) ) {
@@ -1001,6 +1019,7 @@ void options_manager::cOpt::setNext()
 //set to previous item
 void options_manager::cOpt::setPrev()
 {
+    values_revision++;
     if( sType == "string_select" ) {
         int iPrev = static_cast<int>( getItemPos( sSet ) ) - 1;
         if( iPrev < 0 ) {
@@ -1039,6 +1058,7 @@ void options_manager::cOpt::setPrev()
 //set value
 void options_manager::cOpt::setValue( float fSetIn )
 {
+    values_revision++;
     if( sType != "float" ) {
         debugmsg( "tried to set a float value to a %s option", sType );
         return;
@@ -1052,6 +1072,7 @@ void options_manager::cOpt::setValue( float fSetIn )
 //set value
 void options_manager::cOpt::setValue( int iSetIn )
 {
+    values_revision++;
     if( sType != "int" ) {
         debugmsg( "tried to set an int value to a %s option", sType );
         return;
@@ -1065,6 +1086,7 @@ void options_manager::cOpt::setValue( int iSetIn )
 //set value
 void options_manager::cOpt::setValue( const std::string &sSetIn )
 {
+    values_revision++;
     if( sType == "string_select" ) {
         if( getItemPos( sSetIn ) != -1 ) {
             sSet = sSetIn;
@@ -2923,6 +2945,27 @@ void options_manager::add_options_debug()
          0, OVERMAP_LAYERS, 4
        );
 
+    add( "PARALLEL_SHADOWCASTING", "debug", to_translation( "Parallel field of vision" ),
+         to_translation( "If true, field of vision, light sources and transparency are calculated on all processor cores.  "
+                         "The results are the same either way, this only changes how fast they are calculated." ),
+         false
+       );
+
+    add( "PREFETCH_SUBMAPS", "debug", to_translation( "Prefetch map data" ),
+         to_translation( "If true, saved map data in the direction of travel is read in the background before it is needed, to reduce stutter when moving fast." ),
+         false
+       );
+
+    add( "SPECULATIVE_MAPGEN", "debug", to_translation( "Generate map ahead" ),
+         to_translation( "If true, unexplored terrain in the direction of travel is generated a little each turn before it is reached, to reduce stutter when exploring.  Generated terrain then only depends on its location, not on when it was generated." ),
+         false
+       );
+
+    add( "UI_REDRAW_OVERLAY", "debug", to_translation( "Show redraw cost" ),
+         to_translation( "If true, the time each open window took to redraw is shown in the top right corner of the screen." ),
+         false
+       );
+
     add_empty_line();
 
     add_option_group( "debug", Group( "occlusion_opts", to_translation( "Occlusion Options" ),
@@ -3994,6 +4037,7 @@ std::string options_manager::show( bool ingame, const bool world_options_only, b
             if( ingame && world_options_changed ) {
                 ACTIVE_WORLD_OPTIONS = WOPTIONS_OLD;
             }
+            values_revision++;
         }
     }
 
@@ -4110,6 +4154,11 @@ void options_manager::update_options_cache()
     message_ttl = ::get_option<int>( "MESSAGE_TTL" );
     message_cooldown = ::get_option<int>( "MESSAGE_COOLDOWN" );
     fov_3d_z_range = ::get_option<int>( "FOV_3D_Z_RANGE" );
+    set_shadowcasting_pool( ::get_option<bool>( "PARALLEL_SHADOWCASTING" ) ? &get_worker_pool() :
+                            nullptr );
+    prefetch_submaps = ::get_option<bool>( "PREFETCH_SUBMAPS" );
+    speculative_mapgen = ::get_option<bool>( "SPECULATIVE_MAPGEN" );
+    ui_redraw_overlay = ::get_option<bool>( "UI_REDRAW_OVERLAY" );
     keycode_mode = ::get_option<std::string>( "SDL_KEYBOARD_MODE" ) == "keycode";
     use_pinyin_search = ::get_option<bool>( "USE_PINYIN_SEARCH" );
 
@@ -4196,6 +4245,7 @@ options_manager::options_container options_manager::get_world_defaults() const
 
 void options_manager::set_world_options( options_container *options )
 {
+    values_revision++;
     if( options == nullptr ) {
         world_options.reset();
     } else {
@@ -223,6 +223,11 @@ class options_manager
         // updates the caches in options_cache.h
         static void update_options_cache();
 
+        /** Changes whenever the value of any option may have changed, see option_handle. */
+        static unsigned int get_values_revision() {
+            return values_revision;
+        }
+
         /**
          * Returns a copy of the options in the "world default" page. The options have their
          * current value, which acts as the default for new worlds.
@@ -281,6 +286,8 @@ class options_manager
                   const std::string &format = "%.2f" );
 
     private:
+        static unsigned int values_revision;
+
         options_container options;
         std::optional<options_container *> world_options; // NOLINT(cata-serialize)
 
@@ -505,4 +512,51 @@ inline T get_option( const std::string &name, bool convert = false )
     return get_options().get_option( name ).value_as<T>( convert );
 }
 
+class option_handle_base
+{
+    public:
+        const std::string &get_name() const {
+            return name;
+        }
+
+        /** Names of all handles created so far, so tests can check that the options exist. */
+        static std::vector<std::string> &registered_names();
+
+    protected:
+        explicit option_handle_base( const std::string &name );
+
+        std::string name;
+        mutable unsigned int revision = 0;
+};
+
+/**
+ * Typed handle to an option that is read often, e.g. once per turn or per monster.
+ *
+ * get_option() looks the option up by name and converts its value on every call. A handle does
+ * that once and again only after some option changed (see options_manager::get_values_revision),
+ * so usually reading it is just a comparison and a load. Handles are meant to be defined as
+ * statics next to the code using them, like string ids:
+ *
+ *     static const option_handle<bool> option_AUTOSAVE( "AUTOSAVE" );
+ *     ...
+ *     if( option_AUTOSAVE.get() ) {
+ */
+template<typename T>
+class option_handle : public option_handle_base
+{
+    public:
+        explicit option_handle( const std::string &name ) : option_handle_base( name ) {}
+
+        const T &get() const {
+            if( revision != options_manager::get_values_revision() ) {
+                value = ::get_option<T>( name );
+                revision = options_manager::get_values_revision();
+            }
+            return value;
+        }
+
+    private:
+        mutable T value = T();
+};
+
 #endif // CATA_SRC_OPTIONS_H
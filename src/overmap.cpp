@@ -6,11 +6,13 @@
 #include <cmath>
 #include <cstring>
 #include <exception>
+#include <functional>
 #include <memory>
 #include <numeric>
 #include <optional>
 #include <ostream>
 #include <set>
+#include <sstream>
 #include <unordered_set>
 #include <vector>
 
@@ -145,6 +147,9 @@ static constexpr int BUILDINGCHANCE = 4;
 static constexpr int MIN_GOO_SIZE = 1;
 static constexpr int MAX_GOO_SIZE = 2;
 
+// See overmap::get_view_revision
+static unsigned int view_revision = 0;
+
 using oter_type_id = int_id<oter_type_t>;
 using oter_type_str_id = string_id<oter_type_t>;
 
@@ -3144,6 +3149,9 @@ void overmap::init_layers()
         l.visible.fill( om_vision_level::unseen );
         l.explored.fill( false );
     }
+    terrain_layers_dirty = true;
+    view_dirty = true;
+    view_revision++;
 }
 
 void overmap::ter_set( const tripoint_om_omt &p, const oter_id &id )
@@ -3184,6 +3192,10 @@ void overmap::ter_set( const tripoint_om_omt &p, const oter_id &id )
         // We had a predecessor, and it was the same type as the incoming one
         // Don't push another copy.
     }
+    if( current_oter != id ) {
+        terrain_layers_dirty = true;
+        view_revision++;
+    }
     current_oter = id;
 }
 
@@ -3239,7 +3251,12 @@ void overmap::set_seen( const tripoint_om_omt &p, om_vision_level val, bool forc
         return;
     }
 
-    layer[p.z() + OVERMAP_DEPTH].visible[p.xy()] = val;
+    om_vision_level &visible = layer[p.z() + OVERMAP_DEPTH].visible[p.xy()];
+    if( visible != val ) {
+        visible = val;
+        view_dirty = true;
+        view_revision++;
+    }
 
     if( val > om_vision_level::details ) {
         add_extra_note( p );
@@ -3260,6 +3277,9 @@ bool &overmap::explored( const tripoint_om_omt &p )
         nullbool = false;
         return nullbool;
     }
+    // The caller may change it through the reference
+    view_dirty = true;
+    view_revision++;
     return layer[p.z() + OVERMAP_DEPTH].explored[p.xy()];
 }
 
@@ -3404,6 +3424,8 @@ void overmap::add_note( const tripoint_om_omt &p, std::string message )
         return n.p == p.xy();
     } );
 
+    view_dirty = true;
+    view_revision++;
     if( it == std::end( notes ) ) {
         notes.emplace_back( om_note{ std::move( message ), p.xy() } );
     } else if( !message.empty() ) {
@@ -3417,6 +3439,8 @@ void overmap::mark_note_dangerous( const tripoint_om_omt &p, int radius, bool is
 {
     for( om_note &i : layer[p.z() + OVERMAP_DEPTH].notes ) {
         if( p.xy() == i.p ) {
+            view_dirty = true;
+            view_revision++;
             i.dangerous = is_dangerous;
             i.danger_radius = radius;
             return;
@@ -3499,6 +3523,8 @@ void overmap::add_extra( const tripoint_om_omt &p, const map_extra_id &id )
         return n.p == p.xy();
     } );
 
+    view_dirty = true;
+    view_revision++;
     if( it == std::end( extras ) ) {
         extras.emplace_back( om_map_extra{ id, p.xy() } );
         add_extra_note( p );
@@ -3628,6 +3654,8 @@ void overmap::generate( const overmap *north, const overmap *east,
                     layer[z + OVERMAP_DEPTH].terrain[i][j] = omt_outside_defined_omap;
                 }
             }
+            terrain_layers_dirty = true;
+            view_revision++;
         }
     }
     calculate_urbanity();
@@ -7507,10 +7535,16 @@ void overmap::open( overmap_special_batch &enabled_specials )
     if( read_from_file_optional( terfilename, [this, &terfilename]( std::istream & is ) {
     unserialize( terfilename, is );
     } ) ) {
+        terrain_layers_dirty = true;
+        view_revision++;
         const cata_path plrfilename = overmapbuffer::player_filename( loc );
-        read_from_file_optional( plrfilename, [this, &plrfilename]( std::istream & is ) {
-            unserialize_view( plrfilename, is );
-        } );
+        if( read_from_file_optional( plrfilename, [this, &plrfilename]( std::istream & is ) {
+        unserialize_view( plrfilename, is );
+        } ) ) {
+            // The file already holds this view
+            view_dirty = false;
+            view_saved_path = plrfilename.generic_u8string();
+        }
     } else { // No map exists!  Prepare neighbors, and generate one.
         std::vector<const overmap *> pointers;
         // Fetch south and north
@@ -7527,16 +7561,52 @@ void overmap::open( overmap_special_batch &enabled_specials )
     }
 }
 
+unsigned int overmap::get_view_revision()
+{
+    return view_revision;
+}
+
+overmap::save_counters &overmap::get_save_counters()
+{
+    static save_counters counters;
+    return counters;
+}
+
 // Note: this may throw io errors from std::ofstream
 void overmap::save() const
 {
-    write_to_file( overmapbuffer::player_filename( loc ), [&]( std::ostream & stream ) {
-        serialize_view( stream );
-    } );
+    save_counters &counters = get_save_counters();
 
-    write_to_file( overmapbuffer::terrain_filename( loc ), [&]( std::ostream & stream ) {
-        serialize( stream );
-    } );
+    const cata_path view_path = overmapbuffer::player_filename( loc );
+    if( view_dirty || view_saved_path != view_path.generic_u8string() ) {
+        write_to_file( view_path, [&]( std::ostream & stream ) {
+            serialize_view( stream );
+        } );
+        view_dirty = false;
+        view_saved_path = view_path.generic_u8string();
+        counters.view_writes++;
+    } else {
+        counters.skipped_writes++;
+    }
+
+    // Monster groups, NPCs and the rest of the terrain file change in too many places to
+    // track, so serialize them and compare with what was written last time instead.
+    const cata_path terrain_path = overmapbuffer::terrain_filename( loc );
+    std::ostringstream terrain;
+    serialize( terrain );
+    const std::string terrain_text = terrain.str();
+    const size_t terrain_hash = std::hash<std::string> {}( terrain_text );
+    if( terrain_hash != terrain_saved_hash ||
+        terrain_saved_path != terrain_path.generic_u8string() ) {
+        write_to_file( terrain_path, [&]( std::ostream & stream ) {
+            stream << terrain_text;
+        } );
+        terrain_saved_hash = terrain_hash;
+        terrain_saved_path = terrain_path.generic_u8string();
+        counters.terrain_writes++;
+    } else {
+        counters.skipped_writes++;
+    }
 }
 
 void overmap::spawn_mon_group( const mongroup &group, int radius )
@@ -225,8 +225,26 @@ class overmap
             return urbanity;
         }
 
+        /**
+         * Writes the terrain and view files of this overmap. Files whose content did not change
+         * since they were last loaded or written are left alone.
+         */
         void save() const;
 
+        struct save_counters {
+            int view_writes = 0;
+            int terrain_writes = 0;
+            int skipped_writes = 0;
+            int layer_rebuilds = 0;
+        };
+        static save_counters &get_save_counters();
+
+        /**
+         * Counter bumped whenever any overmap changes its terrain or what the player has seen
+         * of it, so caches of the overmap view can tell they are out of date.
+         */
+        static unsigned int get_view_revision();
+
         /**
          * @return The (local) overmap terrain coordinates of a randomly
          * chosen place on the overmap with the specific overmap terrain.
@@ -399,6 +417,18 @@ class overmap
 
         const regional_settings *settings;
 
+        // Save bookkeeping, see save(). The view (seen, explored, notes and extras) is tracked
+        // with a dirty flag set by every function that changes it. The terrain layers are kept
+        // as serialized text until ter_set changes them. Everything else in the terrain file
+        // (monster groups, NPCs, cities, ...) is serialized again on every save and the file is
+        // only written if its hash differs from the last written one.
+        mutable bool view_dirty = true; // NOLINT(cata-serialize)
+        mutable std::string view_saved_path; // NOLINT(cata-serialize)
+        mutable bool terrain_layers_dirty = true; // NOLINT(cata-serialize)
+        mutable std::string terrain_layers_json; // NOLINT(cata-serialize)
+        mutable size_t terrain_saved_hash = 0; // NOLINT(cata-serialize)
+        mutable std::string terrain_saved_path; // NOLINT(cata-serialize)
+
         oter_id get_default_terrain( int z ) const;
 
         // Initialize
@@ -425,6 +455,8 @@ class overmap
         void unserialize_view( const JsonObject &jsobj );
         // Save data in an opened overmap file
         void serialize( std::ostream &fout ) const;
+        // Save the terrain of all z-levels, the "layers" member of the overmap file
+        void serialize_layers( std::ostream &fout ) const;
         // Save per-player overmap view data.
         void serialize_view( std::ostream &fout ) const;
     private:
@@ -601,6 +633,33 @@ struct oter_display_lru {
     std::pair<std::string, nc_color> get_symbol_and_color( const oter_id &cur_ter, om_vision_level );
 };
 
+// What an overmap tile looks like without overlays (notes, NPCs, paths, hordes, ...), cached
+// per location for the ASCII and tiles overmap views, so moving the view only looks up the newly
+// exposed tiles. Everything is dropped when overmap::get_view_revision() or a display setting
+// the entries depend on changes.
+struct oter_display_cache {
+    struct entry {
+        om_vision_level vision = om_vision_level::unseen;
+        // Terrain the tiles view draws: blended with its neighbors, forest trails hidden
+        oter_id shown;
+        // Symbol and color the ASCII view draws
+        std::string sym;
+        nc_color color;
+        bool explored = false;
+        // Whether the ASCII view darkens the tile if it is explored
+        bool darken_explored = false;
+    };
+    struct counters {
+        int hits = 0;
+        int misses = 0;
+        int clears = 0;
+    };
+
+    static const entry &get( const tripoint_abs_omt &omp );
+    static counters &get_counters();
+    static void clear();
+};
+
 // "arguments" to oter_symbol_and_color that do not change between calls in a batch
 struct oter_display_options {
     struct npc_coloring {
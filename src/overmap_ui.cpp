@@ -723,7 +723,7 @@ static void draw_ascii(
             std::string ter_sym = " ";
 
             const om_vision_level vision = has_debug_vision ? om_vision_level::full :
-                                           overmap_buffer.seen( omp );
+                                           oter_display_cache::get( omp ).vision;
             if( vision == om_vision_level::unseen ) {
                 // Only load terrain if we can actually see it
                 cur_ter = overmap_buffer.ter( omp );
@@ -2219,6 +2219,85 @@ oter_vision::blended_omt oter_vision::get_blended_omt_info( const tripoint_abs_o
     return ret;
 }
 
+namespace
+{
+struct oter_display_cache_state {
+    std::unordered_map<tripoint_abs_omt, oter_display_cache::entry> entries;
+    unsigned int view_revision = 0;
+    bool land_use_codes = false;
+    bool forest_trails = false;
+};
+} // namespace
+
+static oter_display_cache_state &get_oter_display_cache_state()
+{
+    static oter_display_cache_state state;
+    return state;
+}
+
+// Large enough for a few screens of overmap, small enough to not hold on to much memory
+static constexpr size_t oter_display_cache_max_entries = 1 << 16;
+
+const oter_display_cache::entry &oter_display_cache::get( const tripoint_abs_omt &omp )
+{
+    oter_display_cache_state &state = get_oter_display_cache_state();
+    counters &stats = get_counters();
+    if( state.view_revision != overmap::get_view_revision() ||
+        state.land_use_codes != uistate.overmap_show_land_use_codes ||
+        state.forest_trails != uistate.overmap_show_forest_trails ||
+        state.entries.size() >= oter_display_cache_max_entries ) {
+        clear();
+        state.view_revision = overmap::get_view_revision();
+        state.land_use_codes = uistate.overmap_show_land_use_codes;
+        state.forest_trails = uistate.overmap_show_forest_trails;
+    }
+    const auto iter = state.entries.find( omp );
+    if( iter != state.entries.end() ) {
+        stats.hits++;
+        return iter->second;
+    }
+    stats.misses++;
+
+    entry cell;
+    cell.vision = overmap_buffer.seen( omp );
+    cell.explored = overmap_buffer.is_explored( omp );
+    // Seen tiles are always on an existing overmap, don't generate new ones just for viewing
+    const oter_id ter = overmap_buffer.ter_existing( omp );
+    cell.shown = ter;
+    if( ter->blends_adjacent( cell.vision ) ) {
+        const oter_vision::blended_omt info = oter_vision::get_blended_omt_info( omp, cell.vision );
+        cell.shown = info.id;
+        cell.sym = info.sym;
+        cell.color = info.color;
+    } else if( cell.vision != om_vision_level::unseen ) {
+        // Same as the last cases of oter_symbol_and_color
+        const oter_id &drawn = !state.forest_trails && ter &&
+                               ter->get_type_id() == oter_type_forest_trail ? oter_forest.id() : ter;
+        cell.sym = drawn->get_symbol( cell.vision, state.land_use_codes );
+        cell.color = drawn->get_color( cell.vision, state.land_use_codes );
+        cell.darken_explored = true;
+    }
+    if( !state.forest_trails && cell.shown->get_type_id() == oter_type_forest_trail ) {
+        cell.shown = oter_forest.id();
+    }
+    return state.entries.emplace( omp, cell ).first->second;
+}
+
+oter_display_cache::counters &oter_display_cache::get_counters()
+{
+    static counters stats;
+    return stats;
+}
+
+void oter_display_cache::clear()
+{
+    oter_display_cache_state &state = get_oter_display_cache_state();
+    if( !state.entries.empty() ) {
+        get_counters().clears++;
+    }
+    state.entries.clear();
+}
+
 std::pair<std::string, nc_color> oter_display_lru::get_symbol_and_color( const oter_id &cur_ter,
         om_vision_level vision )
 {
@@ -2340,6 +2419,13 @@ std::pair<std::string, nc_color> oter_symbol_and_color( const tripoint_abs_omt &
     } else if( !opts.sZoneName.empty() && opts.tripointZone.xy() == omp.xy() ) {
         ret.second = c_yellow;
         ret.first = "Z";
+    } else if( const oter_display_cache::entry &cell = oter_display_cache::get( omp );
+               cell.vision == args.vision ) {
+        // Plain terrain as the player has seen it, looked up once per view change
+        ret = { cell.sym, cell.color };
+        if( opts.show_explored && cell.darken_explored && cell.explored ) {
+            ret.second = c_dark_gray;
+        }
     } else if( cur_ter->blends_adjacent( args.vision ) ) {
         oter_vision::blended_omt here = oter_vision::get_blended_omt_info( omp, args.vision );
         ret.first = here.sym;
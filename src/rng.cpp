@@ -1,23 +1,25 @@
 #include "rng.h"
 
 #include <algorithm>
+#include <atomic>
 #include <chrono>
 #include <cmath>
 
 #include "calendar.h"
 #include "cata_utility.h"
+#include "point.h"
 #include "units.h"
 
 unsigned int rng_bits()
 {
     // Whole uint range.
-    static std::uniform_int_distribution<unsigned int> rng_uint_dist;
+    static thread_local std::uniform_int_distribution<unsigned int> rng_uint_dist;
     return rng_uint_dist( rng_get_engine() );
 }
 
 int rng( int lo, int hi )
 {
-    static std::uniform_int_distribution<int> rng_int_dist;
+    static thread_local std::uniform_int_distribution<int> rng_int_dist;
     if( lo > hi ) {
         std::swap( lo, hi );
     }
@@ -26,7 +28,7 @@ int rng( int lo, int hi )
 
 double rng_float( double lo, double hi )
 {
-    static std::uniform_real_distribution<double> rng_real_dist;
+    static thread_local std::uniform_real_distribution<double> rng_real_dist;
     if( lo > hi ) {
         std::swap( lo, hi );
     }
@@ -77,20 +79,20 @@ float normal_roll_chance( float center, float stddev, float difficulty )
 
 double normal_roll( double mean, double stddev )
 {
-    static std::normal_distribution<double> rng_normal_dist;
+    static thread_local std::normal_distribution<double> rng_normal_dist;
     return rng_normal_dist( rng_get_engine(), std::normal_distribution<>::param_type( mean, stddev ) );
 }
 
 double exponential_roll( double lambda )
 {
-    static std::exponential_distribution<double> rng_exponential_dist;
+    static thread_local std::exponential_distribution<double> rng_exponential_dist;
     return rng_exponential_dist( rng_get_engine(),
                                  std::exponential_distribution<>::param_type( lambda ) );
 }
 
 double chi_squared_roll( double trial_num )
 {
-    static std::chi_squared_distribution<double> rng_chi_squared_dist;
+    static thread_local std::chi_squared_distribution<double> rng_chi_squared_dist;
     return rng_chi_squared_dist( rng_get_engine(),
                                  std::chi_squared_distribution<>::param_type( trial_num ) );
 }
@@ -196,10 +198,19 @@ cata_default_random_engine::result_type rng_get_first_seed()
     return static_cast<cata_default_random_engine::result_type>( seed );
 }
 
+// Engine of the innermost rng_stream_scope of this thread, if any
+static thread_local cata_default_random_engine *scoped_engine = nullptr;
+
 cata_default_random_engine &rng_get_engine()
 {
+    if( scoped_engine != nullptr ) {
+        return *scoped_engine;
+    }
+    // Every thread has its own engine, so that workers of a worker_pool can draw numbers.
+    // The first thread to draw gets the first seed, later ones get seeds of their own.
+    static std::atomic<unsigned int> engines{ 0 };
     // NOLINTNEXTLINE(cata-determinism)
-    static cata_default_random_engine eng( rng_get_first_seed() );
+    static thread_local cata_default_random_engine eng( rng_get_first_seed() + engines++ );
     return eng;
 }
 
@@ -210,6 +221,57 @@ void rng_set_engine_seed( unsigned int seed )
     }
 }
 
+// splitmix64 finalizer, spreads keys that differ in a few bits over the whole range
+static std::uint64_t mix_key( std::uint64_t key )
+{
+    key += 0x9e3779b97f4a7c15ULL;
+    key = ( key ^ ( key >> 30 ) ) * 0xbf58476d1ce4e5b9ULL;
+    key = ( key ^ ( key >> 27 ) ) * 0x94d049bb133111ebULL;
+    return key ^ ( key >> 31 );
+}
+
+rng_stream::rng_stream( std::uint64_t key ) : key( key ),
+    eng( static_cast<cata_default_random_engine::result_type>( mix_key( key ) ) )
+{
+}
+
+rng_stream rng_stream::fork( std::uint64_t child ) const
+{
+    return rng_stream( mix_key( key + mix_key( child ) ) );
+}
+
+rng_stream rng_stream::fork( const point &p ) const
+{
+    return fork( static_cast<std::uint64_t>( static_cast<std::uint32_t>( p.x ) ) << 32 |
+                 static_cast<std::uint32_t>( p.y ) );
+}
+
+rng_stream rng_stream::fork( const tripoint &p ) const
+{
+    return fork( p.xy() ).fork( static_cast<std::uint64_t>( p.z ) );
+}
+
+rng_stream rng_stream::fork( const time_point &turn ) const
+{
+    return fork( static_cast<std::uint64_t>( to_turn<int>( turn ) ) );
+}
+
+rng_stream_scope::rng_stream_scope( unsigned int seed ) : owned( seed ),
+    previous( scoped_engine )
+{
+    scoped_engine = &owned;
+}
+
+rng_stream_scope::rng_stream_scope( rng_stream &stream ) : previous( scoped_engine )
+{
+    scoped_engine = &stream.engine();
+}
+
+rng_stream_scope::~rng_stream_scope()
+{
+    scoped_engine = previous;
+}
+
 std::string random_string( size_t length )
 {
     auto randchar = []() -> char {
@@ -4,6 +4,7 @@
 
 #include <array>
 #include <cstddef>
+#include <cstdint>
 #include <functional>
 #include <iterator>
 #include <optional>
@@ -15,6 +16,8 @@
 
 class map;
 class time_duration;
+class time_point;
+struct point;
 struct tripoint;
 template<typename Tripoint>
 class tripoint_range;
@@ -23,6 +26,8 @@ class tripoint_range;
 // By default, that engine is seeded by time on first call to such a function.
 // If this function is called with a non-zero seed then the engine will be
 // seeded (or re-seeded) with the given seed.
+// Each thread has an engine of its own, these functions only affect the one of
+// the calling thread. Inside an rng_stream_scope they affect the engine of the scope.
 void rng_set_engine_seed( unsigned int seed );
 
 using cata_default_random_engine = std::minstd_rand0;
@@ -30,6 +35,60 @@ cata_default_random_engine::result_type rng_get_first_seed();
 cata_default_random_engine &rng_get_engine();
 unsigned int rng_bits();
 
+/**
+ * A sequence of random numbers that only depends on its key.
+ *
+ * Streams fork into child streams by key, e.g. a stream for the game can fork one per submap
+ * and that one per turn. A child only depends on the key of its parent and its own key, not on
+ * how many numbers were drawn from the parent, so work split into streams gives the same results
+ * whatever order or thread it runs in. Draw from a stream by installing it with rng_stream_scope,
+ * or pass engine() to the <random> distributions directly.
+ */
+class rng_stream
+{
+    public:
+        explicit rng_stream( std::uint64_t key );
+
+        rng_stream fork( std::uint64_t key ) const;
+        rng_stream fork( const point &p ) const;
+        rng_stream fork( const tripoint &p ) const;
+        rng_stream fork( const time_point &turn ) const;
+
+        std::uint64_t get_key() const {
+            return key;
+        }
+        cata_default_random_engine &engine() {
+            return eng;
+        }
+
+    private:
+        std::uint64_t key;
+        cata_default_random_engine eng;
+};
+
+/**
+ * Makes the rng functions of this thread draw from another engine for the lifetime of this
+ * object, and switches back to the previous one afterwards. Everything in between draws from a
+ * sequence that only depends on the seed or stream, and the previous sequence continues as if
+ * nothing had been drawn. Scopes nest.
+ */
+class rng_stream_scope
+{
+    public:
+        /** Draws from an engine seeded with seed. */
+        explicit rng_stream_scope( unsigned int seed );
+        /** Draws from the stream, which continues where it was left by earlier scopes. */
+        explicit rng_stream_scope( rng_stream &stream );
+        ~rng_stream_scope();
+
+        rng_stream_scope( const rng_stream_scope & ) = delete;
+        rng_stream_scope &operator=( const rng_stream_scope & ) = delete;
+
+    private:
+        cata_default_random_engine owned;
+        cata_default_random_engine *previous;
+};
+
 int rng( int lo, int hi );
 double rng_float( double lo, double hi );
 
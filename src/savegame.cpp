@@ -1076,7 +1076,7 @@ void overmap::serialize_view( std::ostream &fout ) const
         json.start_array();
         serialize_enum_array_to_compacted_sequence( json, layer[z].visible );
         json.end_array();
-        fout << std::endl;
+        json.write_raw( "\n" );
     }
     json.end_array();
 
@@ -1086,7 +1086,7 @@ void overmap::serialize_view( std::ostream &fout ) const
         json.start_array();
         serialize_array_to_compacted_sequence( json, layer[z].explored );
         json.end_array();
-        fout << std::endl;
+        json.write_raw( "\n" );
     }
     json.end_array();
 
@@ -1102,7 +1102,7 @@ void overmap::serialize_view( std::ostream &fout ) const
             json.write( i.dangerous );
             json.write( i.danger_radius );
             json.end_array();
-            fout << std::endl;
+            json.write_raw( "\n" );
         }
         json.end_array();
     }
@@ -1118,7 +1118,7 @@ void overmap::serialize_view( std::ostream &fout ) const
             json.write( i.p.y() );
             json.write( i.id );
             json.end_array();
-            fout << std::endl;
+            json.write_raw( "\n" );
         }
         json.end_array();
     }
@@ -1186,14 +1186,9 @@ void overmap::save_monster_groups( JsonOut &jout ) const
     jout.end_array();
 }
 
-void overmap::serialize( std::ostream &fout ) const
+void overmap::serialize_layers( std::ostream &fout ) const
 {
-    fout << "# version " << savegame_version << std::endl;
-
     JsonOut json( fout, false );
-    json.start_object();
-
-    json.member( "layers" );
     json.start_array();
     for( int z = 0; z < OVERMAP_LAYERS; ++z ) {
         const auto &layer_terrain = layer[z].terrain;
@@ -1224,16 +1219,37 @@ void overmap::serialize( std::ostream &fout ) const
         // End the z-level
         json.end_array();
         // Insert a newline occasionally so the file isn't totally unreadable.
-        fout << std::endl;
+        json.write_raw( "\n" );
     }
     json.end_array();
+}
+
+void overmap::serialize( std::ostream &fout ) const
+{
+    fout << "# version " << savegame_version << std::endl;
+
+    JsonOut json( fout, false );
+    json.start_object();
+
+    json.member( "layers" );
+    // The terrain is most of the file and rarely changes after generation, so its text is
+    // kept until ter_set touches it again.
+    if( terrain_layers_dirty ) {
+        std::ostringstream layers;
+        serialize_layers( layers );
+        terrain_layers_json = layers.str();
+        terrain_layers_dirty = false;
+        get_save_counters().layer_rebuilds++;
+    }
+    json.write_raw( terrain_layers_json );
+    json.set_need_separator();
 
     // temporary, to allow user to manually switch regions during play until regionmap is done.
     json.member( "region_id", settings->id );
-    fout << std::endl;
+    json.write_raw( "\n" );
 
     save_monster_groups( json );
-    fout << std::endl;
+    json.write_raw( "\n" );
 
     json.member( "cities" );
     json.start_array();
@@ -1249,10 +1265,10 @@ void overmap::serialize( std::ostream &fout ) const
         json.end_object();
     }
     json.end_array();
-    fout << std::endl;
+    json.write_raw( "\n" );
 
     json.member( "connections_out", connections_out );
-    fout << std::endl;
+    json.write_raw( "\n" );
 
     json.member( "radios" );
     json.start_array();
@@ -1267,7 +1283,7 @@ void overmap::serialize( std::ostream &fout ) const
         json.end_object();
     }
     json.end_array();
-    fout << std::endl;
+    json.write_raw( "\n" );
 
     json.member( "monster_map" );
     json.start_array();
@@ -1276,7 +1292,7 @@ void overmap::serialize( std::ostream &fout ) const
         i.second.serialize( json );
     }
     json.end_array();
-    fout << std::endl;
+    json.write_raw( "\n" );
 
     json.member( "tracked_vehicles" );
     json.start_array();
@@ -1289,7 +1305,7 @@ void overmap::serialize( std::ostream &fout ) const
         json.end_object();
     }
     json.end_array();
-    fout << std::endl;
+    json.write_raw( "\n" );
 
     json.member( "scent_traces" );
     json.start_array();
@@ -1301,7 +1317,7 @@ void overmap::serialize( std::ostream &fout ) const
         json.end_object();
     }
     json.end_array();
-    fout << std::endl;
+    json.write_raw( "\n" );
 
     json.member( "npcs" );
     json.start_array();
@@ -1309,7 +1325,7 @@ void overmap::serialize( std::ostream &fout ) const
         json.write( *i );
     }
     json.end_array();
-    fout << std::endl;
+    json.write_raw( "\n" );
 
     json.member( "camps" );
     json.start_array();
@@ -1317,7 +1333,7 @@ void overmap::serialize( std::ostream &fout ) const
         json.write( i );
     }
     json.end_array();
-    fout << std::endl;
+    json.write_raw( "\n" );
 
     // Condense the overmap special placements so that all placements of a given special
     // are grouped under a single key for that special.
@@ -1350,10 +1366,10 @@ void overmap::serialize( std::ostream &fout ) const
         json.end_object();
     }
     json.end_array();
-    fout << std::endl;
+    json.write_raw( "\n" );
 
     json.member( "mapgen_arg_storage", mapgen_arg_storage );
-    fout << std::endl;
+    json.write_raw( "\n" );
     json.member( "mapgen_arg_index" );
     json.start_array();
     for( const std::pair<const tripoint_om_omt, std::optional<mapgen_arguments> *> &p :
@@ -1366,20 +1382,20 @@ void overmap::serialize( std::ostream &fout ) const
         json.end_array();
     }
     json.end_array();
-    fout << std::endl;
+    json.write_raw( "\n" );
 
     std::vector<std::pair<om_pos_dir, std::string>> flattened_joins_used(
                 joins_used.begin(), joins_used.end() );
     json.member( "joins_used", flattened_joins_used );
-    fout << std::endl;
+    json.write_raw( "\n" );
 
     std::vector<std::pair<tripoint_om_omt, std::vector<oter_id>>> flattened_predecessors(
         predecessors_.begin(), predecessors_.end() );
     json.member( "predecessors", flattened_predecessors );
-    fout << std::endl;
+    json.write_raw( "\n" );
 
     json.end_object();
-    fout << std::endl;
+    json.write_raw( "\n" );
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////
@@ -2797,10 +2797,12 @@ void item::io( Archive &archive )
     archive.io( "energy", energy, 0_mJ );
 
     int cur_phase = static_cast<int>( current_phase );
+    // Members of the cold block go through a copy, which is only kept if any of them is set
+    cold_data cold_copy = cold_ ? *cold_ : cold_data();
     archive.io( "burnt", burnt, 0 );
     archive.io( "poison", poison, 0 );
-    archive.io( "frequency", frequency, 0 );
-    archive.io( "snip_id", snip_id, snippet_id::NULL_ID() );
+    archive.io( "frequency", cold_copy.frequency, 0 );
+    archive.io( "snip_id", cold_copy.snip_id, snippet_id::NULL_ID() );
     // NB! field is named `irridation` in legacy files
     archive.io( "irridation", irradiation, 0 );
     archive.io( "bday", bday, calendar::start_of_cataclysm );
@@ -2808,7 +2810,7 @@ void item::io( Archive &archive )
     archive.io( "player_id", player_id, -1 );
     archive.io( "item_vars", item_vars, io::empty_default_tag() );
     // TODO: change default to empty string
-    archive.io( "name", corpse_name, std::string() );
+    archive.io( "name", cold_copy.corpse_name, std::string() );
     archive.io( "owner", owner, faction_id::NULL_ID() );
     archive.io( "old_owner", old_owner, faction_id::NULL_ID() );
     archive.io( "invlet", invlet, '\0' );
@@ -2823,7 +2825,7 @@ void item::io( Archive &archive )
     archive.io( "rot", rot, 0_turns );
     archive.io( "last_temp_check", last_temp_check, calendar::start_of_cataclysm );
     archive.io( "current_phase", cur_phase, static_cast<int>( type->phase ) );
-    archive.io( "techniques", techniques, io::empty_default_tag() );
+    archive.io( "techniques", cold_copy.techniques, io::empty_default_tag() );
     archive.io( "faults", faults, io::empty_default_tag() );
     archive.io( "item_tags", item_tags, io::empty_default_tag() );
     archive.io( "components", components, io::empty_default_tag() );
@@ -2857,6 +2859,11 @@ void item::io( Archive &archive )
     archive.io( "relic_data", relic_data, null_relic_ptr );
     static const cata::value_ptr<link_data> null_link_ptr = nullptr;
     archive.io( "link_data", link_, null_link_ptr );
+    if( Archive::is_input::value && ( cold_ || cold_copy.frequency != 0 ||
+                                      !cold_copy.snip_id.is_null() || !cold_copy.corpse_name.empty() ||
+                                      !cold_copy.techniques.empty() ) ) {
+        cold() = std::move( cold_copy );
+    }
     if( has_link_data() ) {
         const optional_vpart_position vp = get_map().veh_at( link().t_abs_pos );
         if( vp ) {
@@ -2881,8 +2888,10 @@ void item::io( Archive &archive )
     if( poison != 0 && note == 0 && !type->snippet_category.empty() ) {
         std::swap( note, poison );
     }
-    if( poison != 0 && frequency == 0 && ( typeId() == itype_radio_on || typeId() == itype_radio ) ) {
-        std::swap( frequency, poison );
+    if( poison != 0 && get_frequency() == 0 && ( typeId() == itype_radio_on ||
+            typeId() == itype_radio ) ) {
+        set_frequency( poison );
+        poison = 0;
     }
     if( poison != 0 && irradiation == 0 && typeId() == itype_rad_badge ) {
         std::swap( irradiation, poison );
@@ -2901,13 +2910,15 @@ void item::io( Archive &archive )
     erase_if( item_tags, [&]( const flag_id & f ) {
         return !f.is_valid();
     } );
+    // item_tags was read directly rather than through set_flag
+    update_tag_bits();
 
     if( note_read ) {
-        snip_id = SNIPPET.migrate_hash_to_id( note );
+        cold().snip_id = SNIPPET.migrate_hash_to_id( note );
     } else {
         std::optional<std::string> snip;
         if( archive.read( "snippet_id", snip ) && snip ) {
-            snip_id = snippet_id( snip.value() );
+            cold().snip_id = snippet_id( snip.value() );
         }
     }
 
@@ -4468,30 +4479,100 @@ void cata_variant::deserialize( const JsonValue &jsin )
 void event_multiset::serialize( JsonOut &jsout ) const
 {
     jsout.start_object();
-    std::vector<summaries_type::value_type> copy( summaries_.begin(), summaries_.end() );
-    jsout.member( "event_counts", copy );
+    jsout.member( "columns" );
+    jsout.start_array();
+    for( const column &col : columns_ ) {
+        jsout.start_object();
+        jsout.member( "field", col.field );
+        jsout.member( "values", col.values );
+        jsout.member( "cells" );
+        jsout.start_array();
+        for( const uint32_t cell : col.cells ) {
+            jsout.write( cell == absent ? -1 : static_cast<int64_t>( cell ) );
+        }
+        jsout.end_array();
+        jsout.end_object();
+    }
+    jsout.end_array();
+    jsout.member( "counts" );
+    jsout.start_array();
+    for( const event_summary &summary : summaries_ ) {
+        jsout.write( summary.count );
+    }
+    jsout.end_array();
+    jsout.member( "first" );
+    jsout.start_array();
+    for( const event_summary &summary : summaries_ ) {
+        jsout.write( summary.first );
+    }
+    jsout.end_array();
+    jsout.member( "last" );
+    jsout.start_array();
+    for( const event_summary &summary : summaries_ ) {
+        jsout.write( summary.last );
+    }
+    jsout.end_array();
     jsout.end_object();
 }
 
 void event_multiset::deserialize( const JsonObject &jo )
 {
     jo.allow_omitted_members();
+    columns_.clear();
+    summaries_.clear();
+    if( jo.has_array( "columns" ) ) {
+        std::vector<int> counts;
+        std::vector<time_point> firsts;
+        std::vector<time_point> lasts;
+        jo.read( "counts", counts, true );
+        jo.read( "first", firsts, true );
+        jo.read( "last", lasts, true );
+        if( firsts.size() != counts.size() || lasts.size() != counts.size() ) {
+            jo.throw_error( "Mismatched event summary columns" );
+        }
+        for( size_t row = 0; row < counts.size(); ++row ) {
+            summaries_.emplace_back( counts[row], firsts[row], lasts[row] );
+        }
+        for( JsonObject jcol : jo.get_array( "columns" ) ) {
+            column &col = columns_.emplace_back();
+            jcol.read( "field", col.field, true );
+            jcol.read( "values", col.values, true );
+            std::vector<int64_t> cells;
+            jcol.read( "cells", cells, true );
+            if( cells.size() != summaries_.size() ) {
+                jcol.throw_error_at( "cells", "Wrong number of cells for event field" );
+            }
+            col.cells.reserve( cells.size() );
+            for( const int64_t cell : cells ) {
+                if( cell >= static_cast<int64_t>( col.values.size() ) ) {
+                    jcol.throw_error_at( "cells", "Cell refers to a missing value" );
+                }
+                col.cells.push_back( cell < 0 ? absent : static_cast<uint32_t>( cell ) );
+            }
+        }
+        rebuild_indices();
+        enforce_row_limit();
+        return;
+    }
+
+    rebuild_indices();
     JsonArray events = jo.get_array( "event_counts" );
     if( !events.empty() && events.get_array( 0 ).has_int( 1 ) ) {
         // TEMPORARY until 0.F
         // Read legacy format with just ints
         std::vector<std::pair<cata::event::data_type, int>> copy;
         jo.read( "event_counts", copy );
-        summaries_.clear();
         for( const std::pair<cata::event::data_type, int> &p : copy ) {
             event_summary summary{ p.second, calendar::start_of_game, calendar::start_of_game };
-            summaries_.emplace( p.first, summary );
+            add( { p.first, summary } );
         }
     } else {
-        // Read actual summaries
+        // Read summaries keyed by their whole event data
         std::vector<std::pair<cata::event::data_type, event_summary>> copy;
         jo.read( "event_counts", copy );
-        summaries_ = { copy.begin(), copy.end() };
+        for( const std::pair<cata::event::data_type, event_summary> &p : copy ) {
+            add( p );
+        }
     }
 }
 
@@ -4509,6 +4590,10 @@ void stats_tracker::deserialize( const JsonObject &jo )
     jo.read( "data", data );
     for( std::pair<const event_type, event_multiset> &d : data ) {
         d.second.set_type( d.first );
+        const auto limit = row_limits.find( d.first );
+        if( limit != row_limits.end() ) {
+            d.second.set_row_limit( limit->second );
+        }
     }
     jo.read( "initial_scores", initial_scores );
 
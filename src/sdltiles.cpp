@@ -61,6 +61,7 @@
 #include "npc.h"
 #include "options.h"
 #include "output.h"
+#include "overmap.h"
 #include "overmap_ui.h"
 #include "overmapbuffer.h"
 #include "path_info.h"
@@ -105,8 +106,6 @@ std::unique_ptr<cataimgui::client> imclient;
 
 #define dbg(x) DebugLog((x),D_SDL) << __FILE__ << ":" << __LINE__ << ": "
 
-static const oter_type_str_id oter_type_forest_trail( "forest_trail" );
-
 static const trait_id trait_DEBUG_CLAIRVOYANCE( "DEBUG_CLAIRVOYANCE" );
 static const trait_id trait_DEBUG_NIGHTVISION( "DEBUG_NIGHTVISION" );
 
@@ -663,19 +662,7 @@ std::pair<std::string, bool> cata_tiles::get_omt_id_rotation_and_subtile(
     const tripoint_abs_omt &omp, int &rota, int &subtile )
 {
     auto oter_at = []( const tripoint_abs_omt & p ) {
-        oter_id cur_ter = overmap_buffer.ter( p );
-        om_vision_level vision = overmap_buffer.seen( p );
-        if( cur_ter->blends_adjacent( vision ) ) {
-            oter_vision::blended_omt info = oter_vision::get_blended_omt_info( p, vision );
-            cur_ter = info.id;
-        }
-
-        if( !uistate.overmap_show_forest_trails &&
-            ( cur_ter->get_type_id() == oter_type_forest_trail ) ) {
-            return oter_id( "forest" );
-        }
-
-        return cur_ter;
+        return oter_display_cache::get( p ).shown;
     };
 
     oter_id ot_id = oter_at( omp );
@@ -822,8 +809,9 @@ void cata_tiles::draw_om( const point &dest, const tripoint_abs_omt &center_abs_
         for( int col = min_col; col < max_col; col++ ) {
             const tripoint_abs_omt omp = origin + point( col, row );
 
-            const om_vision_level vision = overmap_buffer.seen( omp );
-            const bool los = overmap_buffer.seen_more_than( omp, om_vision_level::details ) &&
+            const om_vision_level vision = oter_display_cache::get( omp ).vision;
+            const bool explored = oter_display_cache::get( omp ).explored;
+            const bool los = vision > om_vision_level::details &&
                              ( you.overmap_los( omp, sight_points ) || uistate.overmap_debug_mongroup ||
                                you.has_trait( trait_DEBUG_CLAIRVOYANCE ) );
             // the full string from the ter_id including _north etc.
@@ -853,7 +841,7 @@ void cata_tiles::draw_om( const point &dest, const tripoint_abs_omt &center_abs_
                 }
             }
 
-            const lit_level ll = overmap_buffer.is_explored( omp ) ? lit_level::LOW : lit_level::LIT;
+            const lit_level ll = explored ? lit_level::LOW : lit_level::LIT;
             // light level is now used for choosing between grayscale filter and normal lit tiles.
             draw_from_id_string( id, category,
                                  category == TILE_CATEGORY::OVERMAP_TERRAIN ? "overmap_terrain" : "",
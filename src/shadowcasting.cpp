@@ -3,12 +3,16 @@
 #include <cstdint>
 #include <cstdlib>
 #include <iterator>
+#include <limits>
+#include <memory>
+#include <vector>
 
 #include "cuboid_rectangle.h"
 #include "fragment_cloud.h" // IWYU pragma: keep
 #include "line.h"
 #include "list.h"
 #include "point.h"
+#include "worker_pool.h"
 
 struct slope {
     slope( int_least8_t rise, int_least8_t run ) {
@@ -523,6 +527,75 @@ void cast_vertical_zlight_segment(
     }
 }
 
+namespace
+{
+worker_pool *shadowcasting_pool = nullptr;
+
+template<typename T>
+using zlight_segment = void( * )(
+                           const array_of_grids_of<T> &output_caches,
+                           const array_of_grids_of<const T> &input_arrays,
+                           const array_of_grids_of<const bool> &floor_caches,
+                           const tripoint_bub_ms &offset, int offset_distance, T numerator );
+
+// Casts the segments on the workers of the pool. Worker 0 writes straight into output_caches,
+// the others into buffers of their own that are merged in afterwards. All writes take the
+// maximum of the old and the new value, so the merged result is the same as casting the
+// segments one after another.
+template<typename T>
+void cast_zlight_segments_parallel( worker_pool &pool, const std::vector<zlight_segment<T>> &segments,
+                                    const array_of_grids_of<T> &output_caches,
+                                    const array_of_grids_of<const T> &input_arrays,
+                                    const array_of_grids_of<const bool> &floor_caches,
+                                    const tripoint_bub_ms &origin, const int offset_distance, const T numerator )
+{
+    using grids = std::array<cata::mdarray<T, point_bub_ms>, OVERMAP_LAYERS>;
+    static std::vector<std::unique_ptr<grids>> buffers;
+    const int workers = pool.size();
+    while( static_cast<int>( buffers.size() ) < workers - 1 ) {
+        buffers.emplace_back( std::make_unique<grids>() );
+    }
+    std::vector<array_of_grids_of<T>> worker_caches( workers, output_caches );
+    // Only touched by the thread of the worker, so no synchronization needed
+    std::vector<char> used( workers, 0 );
+    pool.run( static_cast<int>( segments.size() ), [&]( int task, int worker ) {
+        if( worker != 0 && !used[worker] ) {
+            for( int z = 0; z < OVERMAP_LAYERS; z++ ) {
+                ( *buffers[worker - 1] )[z].fill( std::numeric_limits<T>::lowest() );
+                worker_caches[worker][z] = &( *buffers[worker - 1] )[z];
+            }
+        }
+        used[worker] = 1;
+        segments[task]( worker_caches[worker], input_arrays, floor_caches, origin, offset_distance,
+                        numerator );
+    } );
+    for( int worker = 1; worker < workers; worker++ ) {
+        if( !used[worker] ) {
+            continue;
+        }
+        for( int z = 0; z < OVERMAP_LAYERS; z++ ) {
+            cata::mdarray<T, point_bub_ms> &out = *output_caches[z];
+            const cata::mdarray<T, point_bub_ms> &in = ( *buffers[worker - 1] )[z];
+            for( int x = 0; x < MAPSIZE_X; x++ ) {
+                for( int y = 0; y < MAPSIZE_Y; y++ ) {
+                    out[x][y] = std::max( out[x][y], in[x][y] );
+                }
+            }
+        }
+    }
+}
+} // namespace
+
+void set_shadowcasting_pool( worker_pool *pool )
+{
+    shadowcasting_pool = pool;
+}
+
+worker_pool *get_shadowcasting_pool()
+{
+    return shadowcasting_pool;
+}
+
 template<typename T, T( *calc )( const T &, const T &, const int & ),
          bool( *is_transparent )( const T &, const T & ),
          T( *accumulate )( const T &, const T &, const int & )>
@@ -533,128 +606,126 @@ void cast_zlight(
     const tripoint_bub_ms &origin, const int offset_distance, const T numerator,
     vertical_direction dir )
 {
+    static const std::array<zlight_segment<T>, 12> down_segments = { {
+            // Down lateral
+            // @..
+            //  ..
+            //   .
+            &cast_horizontal_zlight_segment < 0, 1, 1, 0, -1, T, calc, is_transparent, accumulate >,
+            // @
+            // ..
+            // ...
+            &cast_horizontal_zlight_segment < 1, 0, 0, 1, -1, T, calc, is_transparent, accumulate >,
+            //   .
+            //  ..
+            // @..
+            &cast_horizontal_zlight_segment < 0, -1, 1, 0, -1, T, calc, is_transparent, accumulate >,
+            // ...
+            // ..
+            // @
+            &cast_horizontal_zlight_segment < -1, 0, 0, 1, -1, T, calc, is_transparent, accumulate >,
+            // ..@
+            // ..
+            // .
+            &cast_horizontal_zlight_segment < 0, 1, -1, 0, -1, T, calc, is_transparent, accumulate >,
+            //   @
+            //  ..
+            // ...
+            &cast_horizontal_zlight_segment < 1, 0, 0, -1, -1, T, calc, is_transparent, accumulate >,
+            // .
+            // ..
+            // ..@
+            &cast_horizontal_zlight_segment < 0, -1, -1, 0, -1, T, calc, is_transparent, accumulate >,
+            // ...
+            //  ..
+            //   @
+            &cast_horizontal_zlight_segment < -1, 0, 0, -1, -1, T, calc, is_transparent, accumulate >,
+
+            // Straight down
+            // @.
+            // ..
+            &cast_vertical_zlight_segment < 1, 1, -1, T, calc, is_transparent, accumulate >,
+            // ..
+            // @.
+            &cast_vertical_zlight_segment < 1, -1, -1, T, calc, is_transparent, accumulate >,
+            // .@
+            // ..
+            &cast_vertical_zlight_segment < -1, 1, -1, T, calc, is_transparent, accumulate >,
+            // ..
+            // .@
+            &cast_vertical_zlight_segment < -1, -1, -1, T, calc, is_transparent, accumulate >
+        }
+    };
+    static const std::array<zlight_segment<T>, 12> up_segments = { {
+            // Up lateral
+            // @..
+            //  ..
+            //   .
+            &cast_horizontal_zlight_segment < 0, 1, 1, 0, 1, T, calc, is_transparent, accumulate >,
+            // @
+            // ..
+            // ...
+            &cast_horizontal_zlight_segment < 1, 0, 0, 1, 1, T, calc, is_transparent, accumulate >,
+            // ..@
+            // ..
+            // .
+            &cast_horizontal_zlight_segment < 0, -1, 1, 0, 1, T, calc, is_transparent, accumulate >,
+            //   @
+            //  ..
+            // ...
+            &cast_horizontal_zlight_segment < -1, 0, 0, 1, 1, T, calc, is_transparent, accumulate >,
+            //   .
+            //  ..
+            // @..
+            &cast_horizontal_zlight_segment < 0, 1, -1, 0, 1, T, calc, is_transparent, accumulate >,
+            // ...
+            // ..
+            // @
+            &cast_horizontal_zlight_segment < 1, 0, 0, -1, 1, T, calc, is_transparent, accumulate >,
+            // .
+            // ..
+            // ..@
+            &cast_horizontal_zlight_segment < 0, -1, -1, 0, 1, T, calc, is_transparent, accumulate >,
+            // ...
+            //  ..
+            //   @
+            &cast_horizontal_zlight_segment < -1, 0, 0, -1, 1, T, calc, is_transparent, accumulate >,
+
+            // Straight up
+            // @.
+            // ..
+            &cast_vertical_zlight_segment < 1, 1, 1, T, calc, is_transparent, accumulate >,
+            // ..
+            // @.
+            &cast_vertical_zlight_segment < 1, -1, 1, T, calc, is_transparent, accumulate >,
+            // .@
+            // ..
+            &cast_vertical_zlight_segment < -1, 1, 1, T, calc, is_transparent, accumulate >,
+            // ..
+            // .@
+            &cast_vertical_zlight_segment < -1, -1, 1, T, calc, is_transparent, accumulate >
+        }
+    };
+
+    std::vector<zlight_segment<T>> segments;
     if( dir == vertical_direction::DOWN || dir == vertical_direction::BOTH ) {
-        // Down lateral
-        // @..
-        //  ..
-        //   .
-        cast_horizontal_zlight_segment < 0, 1, 1, 0, -1, T, calc, is_transparent, accumulate > (
-            output_caches, input_arrays, floor_caches, origin, offset_distance, numerator );
-        // @
-        // ..
-        // ...
-        cast_horizontal_zlight_segment < 1, 0, 0, 1, -1, T, calc, is_transparent, accumulate > (
-            output_caches, input_arrays, floor_caches, origin, offset_distance, numerator );
-        //   .
-        //  ..
-        // @..
-        cast_horizontal_zlight_segment < 0, -1, 1, 0, -1, T, calc, is_transparent, accumulate > (
-            output_caches, input_arrays, floor_caches, origin, offset_distance, numerator );
-        // ...
-        // ..
-        // @
-        cast_horizontal_zlight_segment < -1, 0, 0, 1, -1, T, calc, is_transparent, accumulate > (
-            output_caches, input_arrays, floor_caches, origin, offset_distance, numerator );
-        // ..@
-        // ..
-        // .
-        cast_horizontal_zlight_segment < 0, 1, -1, 0, -1, T, calc, is_transparent, accumulate > (
-            output_caches, input_arrays, floor_caches, origin, offset_distance, numerator );
-        //   @
-        //  ..
-        // ...
-        cast_horizontal_zlight_segment < 1, 0, 0, -1, -1, T, calc, is_transparent, accumulate > (
-            output_caches, input_arrays, floor_caches, origin, offset_distance, numerator );
-        // .
-        // ..
-        // ..@
-        cast_horizontal_zlight_segment < 0, -1, -1, 0, -1, T, calc, is_transparent, accumulate > (
-            output_caches, input_arrays, floor_caches, origin, offset_distance, numerator );
-        // ...
-        //  ..
-        //   @
-        cast_horizontal_zlight_segment < -1, 0, 0, -1, -1, T, calc, is_transparent, accumulate > (
-            output_caches, input_arrays, floor_caches, origin, offset_distance, numerator );
-
-        // Straight down
-        // @.
-        // ..
-        cast_vertical_zlight_segment < 1, 1, -1, T, calc, is_transparent, accumulate > (
-            output_caches, input_arrays, floor_caches, origin, offset_distance, numerator );
-        // ..
-        // @.
-        cast_vertical_zlight_segment < 1, -1, -1, T, calc, is_transparent, accumulate > (
-            output_caches, input_arrays, floor_caches, origin, offset_distance, numerator );
-        // .@
-        // ..
-        cast_vertical_zlight_segment < -1, 1, -1, T, calc, is_transparent, accumulate > (
-            output_caches, input_arrays, floor_caches, origin, offset_distance, numerator );
-        // ..
-        // .@
-        cast_vertical_zlight_segment < -1, -1, -1, T, calc, is_transparent, accumulate > (
-            output_caches, input_arrays, floor_caches, origin, offset_distance, numerator );
+        segments.insert( segments.end(), down_segments.begin(), down_segments.end() );
     }
-
     if( dir == vertical_direction::UP || dir == vertical_direction::BOTH ) {
-        // Up lateral
-        // @..
-        //  ..
-        //   .
-        cast_horizontal_zlight_segment < 0, 1, 1, 0, 1, T, calc, is_transparent, accumulate > (
-            output_caches, input_arrays, floor_caches, origin, offset_distance, numerator );
-        // @
-        // ..
-        // ...
-        cast_horizontal_zlight_segment < 1, 0, 0, 1, 1, T, calc, is_transparent, accumulate > (
-            output_caches, input_arrays, floor_caches, origin, offset_distance, numerator );
-        // ..@
-        // ..
-        // .
-        cast_horizontal_zlight_segment < 0, -1, 1, 0, 1, T, calc, is_transparent, accumulate > (
-            output_caches, input_arrays, floor_caches, origin, offset_distance, numerator );
-        //   @
-        //  ..
-        // ...
-        cast_horizontal_zlight_segment < -1, 0, 0, 1, 1, T, calc, is_transparent, accumulate > (
-            output_caches, input_arrays, floor_caches, origin, offset_distance, numerator );
-        //   .
-        //  ..
-        // @..
-        cast_horizontal_zlight_segment < 0, 1, -1, 0, 1, T, calc, is_transparent, accumulate > (
-            output_caches, input_arrays, floor_caches, origin, offset_distance, numerator );
-        // ...
-        // ..
-        // @
-        cast_horizontal_zlight_segment < 1, 0, 0, -1, 1, T, calc, is_transparent, accumulate > (
-            output_caches, input_arrays, floor_caches, origin, offset_distance, numerator );
-        // .
-        // ..
-        // ..@
-        cast_horizontal_zlight_segment < 0, -1, -1, 0, 1, T, calc, is_transparent, accumulate > (
-            output_caches, input_arrays, floor_caches, origin, offset_distance, numerator );
-        // ...
-        //  ..
-        //   @
-        cast_horizontal_zlight_segment < -1, 0, 0, -1, 1, T, calc, is_transparent, accumulate > (
-            output_caches, input_arrays, floor_caches, origin, offset_distance, numerator );
-
-        // Straight up
-        // @.
-        // ..
-        cast_vertical_zlight_segment < 1, 1, 1, T, calc, is_transparent, accumulate > (
-            output_caches, input_arrays, floor_caches, origin, offset_distance, numerator );
-        // ..
-        // @.
-        cast_vertical_zlight_segment < 1, -1, 1, T, calc, is_transparent, accumulate > (
-            output_caches, input_arrays, floor_caches, origin, offset_distance, numerator );
-        // .@
-        // ..
-        cast_vertical_zlight_segment < -1, 1, 1, T, calc, is_transparent, accumulate > (
-            output_caches, input_arrays, floor_caches, origin, offset_distance, numerator );
-        // ..
-        // .@
-        cast_vertical_zlight_segment < -1, -1, 1, T, calc, is_transparent, accumulate > (
-            output_caches, input_arrays, floor_caches, origin, offset_distance, numerator );
+        segments.insert( segments.end(), up_segments.begin(), up_segments.end() );
+    }
+
+    // Only floats are cast in parallel: merging by maximum gives the same result as casting in
+    // order only if equal values are indistinguishable, which isn't true for fragment clouds.
+    if constexpr( std::is_same_v<T, float> ) {
+        if( shadowcasting_pool != nullptr && shadowcasting_pool->size() > 1 ) {
+            cast_zlight_segments_parallel<T>( *shadowcasting_pool, segments, output_caches, input_arrays,
+                                              floor_caches, origin, offset_distance, numerator );
+            return;
+        }
+    }
+    for( const zlight_segment<T> segment : segments ) {
+        segment( output_caches, input_arrays, floor_caches, origin, offset_distance, numerator );
     }
 }
 
@@ -13,6 +13,7 @@
 #include "lightmap.h"
 #include "mdarray.h"
 
+class worker_pool;
 struct point;
 struct tripoint;
 
@@ -132,6 +133,13 @@ using array_of_grids_of =
     std::array<cata::mdarray<T, point_bub_ms>*, OVERMAP_LAYERS>
     >;
 
+/**
+ * Sets the pool cast_zlight splits its segments over, or nullptr (the default) to cast them
+ * one after another on the calling thread. Both give exactly the same results.
+ */
+void set_shadowcasting_pool( worker_pool *pool );
+worker_pool *get_shadowcasting_pool();
+
 // TODO: Generalize the floor check, allow semi-transparent floors
 template< typename T, T( *calc )( const T &, const T &, const int & ),
           bool( *check )( const T &, const T & ),
@@ -11,20 +11,9 @@
 #include "cata_assert.h"
 #include "debug.h"
 #include "event_statistics.h"
+#include "hash_utils.h"
 #include "json.h"
 
-static bool event_data_matches( const cata::event::data_type &data,
-                                const cata::event::data_type &criteria )
-{
-    for( const auto &criterion : criteria ) {
-        auto it = data.find( criterion.first );
-        if( it == data.end() || it->second != criterion.second ) {
-            return false;
-        }
-    }
-    return true;
-}
-
 event_summary::event_summary() :
     count( 0 ),
     first( calendar::before_time_starts ),
@@ -83,21 +72,42 @@ void event_multiset::set_type( event_type type )
     type_ = type;
 }
 
-int event_multiset::count() const
+event_multiset::summaries_type event_multiset::counts() const
 {
-    int total = 0;
-    for( const auto &pair : summaries_ ) {
-        total += pair.second.count;
+    summaries_type result;
+    result.reserve( summaries_.size() );
+    for( size_t row = 0; row < summaries_.size(); ++row ) {
+        result.emplace( row_data( row ), summaries_[row] );
+    }
+    return result;
+}
+
+void event_multiset::visit( const std::function<void( const cata::event::data_type &,
+                            const event_summary & )> &func ) const
+{
+    for( size_t row = 0; row < summaries_.size(); ++row ) {
+        func( row_data( row ), summaries_[row] );
     }
-    return total;
+}
+
+int event_multiset::count() const
+{
+    return count_;
 }
 
 int event_multiset::count( const cata::event::data_type &criteria ) const
 {
+    const std::optional<resolved_criteria> resolved = resolve( criteria );
+    if( !resolved ) {
+        return 0;
+    }
+    if( resolved->empty() ) {
+        return count_;
+    }
     int total = 0;
-    for( const auto &pair : summaries_ ) {
-        if( event_data_matches( pair.first, criteria ) ) {
-            total += pair.second.count;
+    for( size_t row = 0; row < summaries_.size(); ++row ) {
+        if( matches( row, *resolved ) ) {
+            total += summaries_[row].count;
         }
     }
     return total;
@@ -105,19 +115,25 @@ int event_multiset::count( const cata::event::data_type &criteria ) const
 
 int event_multiset::total( const std::string &field ) const
 {
-    return total( field, {} );
+    const column *col = find_column( field );
+    return col ? col->total : 0;
 }
 
 int event_multiset::total( const std::string &field, const cata::event::data_type &criteria ) const
 {
+    const std::optional<resolved_criteria> resolved = resolve( criteria );
+    const column *col = find_column( field );
+    if( !resolved || !col ) {
+        return 0;
+    }
+    if( resolved->empty() ) {
+        return col->total;
+    }
     int total = 0;
-    for( const auto &pair : summaries_ ) {
-        auto it = pair.first.find( field );
-        if( it == pair.first.end() ) {
-            continue;
-        }
-        if( event_data_matches( pair.first, criteria ) ) {
-            total += pair.second.count * it->second.get<cata_variant_type::int_>();
+    for( size_t row = 0; row < summaries_.size(); ++row ) {
+        const uint32_t cell = col->cells[row];
+        if( cell != absent && matches( row, *resolved ) ) {
+            total += summaries_[row].count * col->values[cell].get<cata_variant_type::int_>();
         }
     }
     return total;
@@ -125,41 +141,20 @@ int event_multiset::total( const std::string &field, const cata::event::data_typ
 
 int event_multiset::minimum( const std::string &field ) const
 {
-    int minimum = 0;
-    for( const auto &pair : summaries_ ) {
-        auto it = pair.first.find( field );
-        if( it == pair.first.end() ) {
-            continue;
-        }
-        const int potential = it->second.get<cata_variant_type::int_>();
-        if( potential < minimum ) {
-            minimum = potential;
-        }
-    }
-    return minimum;
+    const column *col = find_column( field );
+    return col ? col->minimum : 0;
 }
 
 int event_multiset::maximum( const std::string &field ) const
 {
-    int maximum = 0;
-    for( const auto &pair : summaries_ ) {
-        auto it = pair.first.find( field );
-        if( it == pair.first.end() ) {
-            continue;
-        }
-        const int potential = it->second.get<cata_variant_type::int_>();
-        if( potential > maximum ) {
-            maximum = potential;
-        }
-    }
-    return maximum;
+    const column *col = find_column( field );
+    return col ? col->maximum : 0;
 }
 
 template<time_point event_summary::*Member>
 struct compare_times {
-    bool operator()( const event_multiset::summaries_type::value_type &l,
-                     const event_multiset::summaries_type::value_type &r ) const {
-        return l.second.*Member < r.second.*Member;
+    bool operator()( const event_summary &l, const event_summary &r ) const {
+        return l.*Member < r.*Member;
     }
 };
 
@@ -170,27 +165,226 @@ std::optional<event_multiset::summaries_type::value_type> event_multiset::first(
     if( minimum == summaries_.end() ) {
         return std::nullopt;
     }
-    return *minimum;
+    return summaries_type::value_type( row_data( minimum - summaries_.begin() ), *minimum );
 }
 
 std::optional<event_multiset::summaries_type::value_type> event_multiset::last() const
 {
-    auto minimum = std::max_element( summaries_.begin(), summaries_.end(),
+    auto maximum = std::max_element( summaries_.begin(), summaries_.end(),
                                      compare_times<&event_summary::last>() );
-    if( minimum == summaries_.end() ) {
+    if( maximum == summaries_.end() ) {
         return std::nullopt;
     }
-    return *minimum;
+    return summaries_type::value_type( row_data( maximum - summaries_.begin() ), *maximum );
 }
 
 void event_multiset::add( const cata::event &e )
 {
-    summaries_[e.data()].add( e );
+    const size_t row = row_of( e.data() );
+    summaries_[row].add( e );
+    add_to_aggregates( row, 1 );
+    enforce_row_limit();
 }
 
 void event_multiset::add( const summaries_type::value_type &e )
 {
-    summaries_[e.first].add( e.second );
+    const size_t row = row_of( e.first );
+    summaries_[row].add( e.second );
+    add_to_aggregates( row, e.second.count );
+    enforce_row_limit();
+}
+
+void event_multiset::set_row_limit( std::optional<size_t> max_rows )
+{
+    row_limit_ = max_rows;
+    enforce_row_limit();
+}
+
+size_t event_multiset::row_of( const cata::event::data_type &data )
+{
+    std::vector<uint32_t> cells( columns_.size(), absent );
+    for( const std::pair<const std::string, cata_variant> &field : data ) {
+        auto col = std::find_if( columns_.begin(), columns_.end(), [&]( const column & c ) {
+            return c.field == field.first;
+        } );
+        if( col == columns_.end() ) {
+            column &added = columns_.emplace_back();
+            added.field = field.first;
+            added.cells.assign( summaries_.size(), absent );
+            cells.push_back( absent );
+            col = columns_.end() - 1;
+        }
+        const auto value = col->value_index.emplace( field.second, col->values.size() );
+        if( value.second ) {
+            col->values.push_back( field.second );
+        }
+        cells[col - columns_.begin()] = value.first->second;
+    }
+
+    size_t hash = 0;
+    for( size_t c = 0; c < cells.size(); ++c ) {
+        if( cells[c] != absent ) {
+            cata::hash_combine( hash, c );
+            cata::hash_combine( hash, cells[c] );
+        }
+    }
+    const auto candidates = rows_by_hash_.equal_range( hash );
+    for( auto it = candidates.first; it != candidates.second; ++it ) {
+        const size_t row = it->second;
+        bool same = true;
+        for( size_t c = 0; c < cells.size() && same; ++c ) {
+            same = columns_[c].cells[row] == cells[c];
+        }
+        if( same ) {
+            return row;
+        }
+    }
+
+    const size_t row = summaries_.size();
+    for( size_t c = 0; c < cells.size(); ++c ) {
+        columns_[c].cells.push_back( cells[c] );
+    }
+    summaries_.emplace_back();
+    rows_by_hash_.emplace( hash, static_cast<uint32_t>( row ) );
+    return row;
+}
+
+size_t event_multiset::hash_row( size_t row ) const
+{
+    // Must match the hash in row_of.  Absent cells are skipped so that adding
+    // a column leaves the hashes of the existing rows alone.
+    size_t hash = 0;
+    for( size_t c = 0; c < columns_.size(); ++c ) {
+        if( columns_[c].cells[row] != absent ) {
+            cata::hash_combine( hash, c );
+            cata::hash_combine( hash, columns_[c].cells[row] );
+        }
+    }
+    return hash;
+}
+
+cata::event::data_type event_multiset::row_data( size_t row ) const
+{
+    cata::event::data_type data;
+    for( const column &col : columns_ ) {
+        if( col.cells[row] != absent ) {
+            data.emplace( col.field, col.values[col.cells[row]] );
+        }
+    }
+    return data;
+}
+
+const event_multiset::column *event_multiset::find_column( const std::string &field ) const
+{
+    for( const column &col : columns_ ) {
+        if( col.field == field ) {
+            return &col;
+        }
+    }
+    return nullptr;
+}
+
+std::optional<event_multiset::resolved_criteria> event_multiset::resolve(
+    const cata::event::data_type &criteria ) const
+{
+    resolved_criteria result;
+    for( const std::pair<const std::string, cata_variant> &criterion : criteria ) {
+        const column *col = find_column( criterion.first );
+        if( !col ) {
+            return std::nullopt;
+        }
+        const auto value = col->value_index.find( criterion.second );
+        if( value == col->value_index.end() ) {
+            return std::nullopt;
+        }
+        result.emplace_back( col - columns_.data(), value->second );
+    }
+    return result;
+}
+
+bool event_multiset::matches( size_t row, const resolved_criteria &criteria ) const
+{
+    for( const std::pair<size_t, uint32_t> &criterion : criteria ) {
+        if( columns_[criterion.first].cells[row] != criterion.second ) {
+            return false;
+        }
+    }
+    return true;
+}
+
+void event_multiset::add_to_aggregates( size_t row, int count )
+{
+    count_ += count;
+    for( column &col : columns_ ) {
+        const uint32_t cell = col.cells[row];
+        if( cell == absent || col.values[cell].type() != cata_variant_type::int_ ) {
+            continue;
+        }
+        const int value = col.values[cell].get<cata_variant_type::int_>();
+        col.total += count * value;
+        col.minimum = std::min( col.minimum, value );
+        col.maximum = std::max( col.maximum, value );
+    }
+}
+
+void event_multiset::rebuild_indices()
+{
+    rows_by_hash_.clear();
+    count_ = 0;
+    for( column &col : columns_ ) {
+        col.value_index.clear();
+        for( size_t i = 0; i < col.values.size(); ++i ) {
+            col.value_index.emplace( col.values[i], static_cast<uint32_t>( i ) );
+        }
+        col.total = col.minimum = col.maximum = 0;
+    }
+    for( size_t row = 0; row < summaries_.size(); ++row ) {
+        rows_by_hash_.emplace( hash_row( row ), static_cast<uint32_t>( row ) );
+        add_to_aggregates( row, summaries_[row].count );
+    }
+}
+
+void event_multiset::enforce_row_limit()
+{
+    if( !row_limit_ || summaries_.size() <= *row_limit_ ) {
+        return;
+    }
+    // Keep the most recently seen rows, in their original order
+    const size_t kept = *row_limit_ - *row_limit_ / 4;
+    std::vector<size_t> rows( summaries_.size() );
+    for( size_t row = 0; row < rows.size(); ++row ) {
+        rows[row] = row;
+    }
+    std::stable_sort( rows.begin(), rows.end(), [this]( size_t l, size_t r ) {
+        return summaries_[l].last > summaries_[r].last;
+    } );
+    rows.resize( kept );
+    std::sort( rows.begin(), rows.end() );
+
+    std::vector<event_summary> summaries;
+    summaries.reserve( kept );
+    for( size_t row : rows ) {
+        summaries.push_back( summaries_[row] );
+    }
+    summaries_ = std::move( summaries );
+    for( column &col : columns_ ) {
+        // Drop the values no kept row uses
+        std::vector<uint32_t> new_index( col.values.size(), absent );
+        std::vector<cata_variant> values;
+        std::vector<uint32_t> cells;
+        cells.reserve( kept );
+        for( size_t row : rows ) {
+            const uint32_t cell = col.cells[row];
+            if( cell != absent && new_index[cell] == absent ) {
+                new_index[cell] = static_cast<uint32_t>( values.size() );
+                values.push_back( col.values[cell] );
+            }
+            cells.push_back( cell == absent ? absent : new_index[cell] );
+        }
+        col.values = std::move( values );
+        col.cells = std::move( cells );
+    }
+    rebuild_indices();
 }
 
 base_watcher::~base_watcher()
@@ -231,7 +425,24 @@ stats_tracker::~stats_tracker()
 
 event_multiset &stats_tracker::get_events( event_type type )
 {
-    return data.emplace( type, event_multiset( type ) ).first->second;
+    const auto inserted = data.emplace( type, event_multiset( type ) );
+    if( inserted.second ) {
+        const auto limit = row_limits.find( type );
+        if( limit != row_limits.end() ) {
+            inserted.first->second.set_row_limit( limit->second );
+        }
+    }
+    return inserted.first->second;
+}
+
+void stats_tracker::set_row_limit( event_type type, std::optional<size_t> max_rows )
+{
+    if( max_rows ) {
+        row_limits[type] = *max_rows;
+    } else {
+        row_limits.erase( type );
+    }
+    get_events( type ).set_row_limit( max_rows );
 }
 
 event_multiset stats_tracker::get_events(
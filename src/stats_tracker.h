@@ -2,10 +2,14 @@
 #ifndef CATA_SRC_STATS_TRACKER_H
 #define CATA_SRC_STATS_TRACKER_H
 
+#include <cstddef>
+#include <cstdint>
+#include <functional>
 #include <iosfwd>
 #include <memory>
 #include <optional>
 #include <set>
+#include <string>
 #include <type_traits>
 #include <unordered_map>
 #include <unordered_set>
@@ -36,6 +40,9 @@ class stats_tracker;
 // (an event::data_type object, which is a map of keys to values).
 // Within each partition, an event_summary is stored, which contains the first
 // and last times such events were seen, and the number of them seen.
+// The partitions are stored by column: each distinct data is a row, each field
+// a column, and the values of a column are interned so that a row is just a
+// few indices.
 // The stats_tracker can be queried in various ways to get summary statistics
 // about events that have occurred.
 
@@ -67,8 +74,14 @@ class event_multiset
 
         void set_type( event_type );
 
-        const summaries_type &counts() const {
-            return summaries_;
+        // Every distinct event data with its summary.  This builds the whole
+        // map, so prefer visit() or the queries below.
+        summaries_type counts() const;
+        void visit( const std::function<void( const cata::event::data_type &,
+                                              const event_summary & )> &func ) const;
+        // Number of distinct event data
+        size_t size() const {
+            return summaries_.size();
         }
 
         // count returns the number of events matching given criteria that have
@@ -97,11 +110,48 @@ class event_multiset
         void add( const cata::event & );
         void add( const summaries_type::value_type & );
 
+        // Optional retention policy: once there are more than max_rows
+        // distinct event data, the least recently seen are forgotten, keeping
+        // three quarters of max_rows.  Forgotten events no longer count in
+        // any query.  Unlimited by default.
+        void set_row_limit( std::optional<size_t> max_rows );
+
         void serialize( JsonOut & ) const;
         void deserialize( const JsonObject &jo );
     private:
+        static constexpr uint32_t absent = UINT32_MAX;
+
+        struct column {
+            std::string field;
+            std::vector<cata_variant> values;
+            std::unordered_map<cata_variant, uint32_t> value_index;
+            // Index into values for each row, or absent
+            std::vector<uint32_t> cells;
+            // Aggregates of the int values, weighted by the event counts
+            int total = 0;
+            int minimum = 0;
+            int maximum = 0;
+        };
+        // Column index and value index of each criterion
+        using resolved_criteria = std::vector<std::pair<size_t, uint32_t>>;
+
+        size_t row_of( const cata::event::data_type &data );
+        size_t hash_row( size_t row ) const;
+        cata::event::data_type row_data( size_t row ) const;
+        const column *find_column( const std::string &field ) const;
+        std::optional<resolved_criteria> resolve( const cata::event::data_type &criteria ) const;
+        bool matches( size_t row, const resolved_criteria &criteria ) const;
+        void add_to_aggregates( size_t row, int count );
+        void rebuild_indices();
+        void enforce_row_limit();
+
         event_type type_; // NOLINT(cata-serialize)
-        summaries_type summaries_;
+        std::vector<column> columns_;
+        std::vector<event_summary> summaries_;
+        // Rows by the hash of their cells
+        std::unordered_multimap<size_t, uint32_t> rows_by_hash_; // NOLINT(cata-serialize)
+        int count_ = 0; // NOLINT(cata-serialize)
+        std::optional<size_t> row_limit_; // NOLINT(cata-serialize)
 };
 
 class base_watcher
@@ -190,6 +240,8 @@ class stats_tracker : public event_subscriber
         ~stats_tracker() override;
 
         event_multiset &get_events( event_type );
+        // See event_multiset::set_row_limit
+        void set_row_limit( event_type, std::optional<size_t> max_rows );
         event_multiset get_events( const string_id<event_transformation> & );
 
         cata_variant value_of( const string_id<event_statistic> & );
@@ -221,6 +273,7 @@ class stats_tracker : public event_subscriber
         void unwatch_all();
 
         std::unordered_map<event_type, event_multiset> data;
+        std::unordered_map<event_type, size_t> row_limits; // NOLINT(cata-serialize)
 
         // NOLINTNEXTLINE(cata-serialize)
         std::unordered_map<event_type, watcher_set<event_multiset_watcher>> event_type_watchers;
@@ -244,6 +244,14 @@ public:
     bool operator!=( const This &rhs ) const {
         return ! operator==( rhs );
     }
+    /**
+     * Index of the interned string, unique per string for the lifetime of the process but,
+     * like operator<, not the same after a restart. Hashing, comparing and ordering ids all
+     * come down to this int, see cata::flat_id_set. Only available for interned (non dynamic) ids.
+     */
+    int interned_index() const {
+        return _id._id;
+    }
     /**
      * Interface to the plain C-string of the id. This function mimics the std::string
      * object. Ids are often used in debug messages, where they are forwarded as C-strings
@@ -361,7 +369,8 @@ private:
     friend struct std::hash<string_id<T>>;
 };
 
-// Support hashing of string based ids by forwarding the hash of the string.
+// Support hashing of string based ids by forwarding the hash of the identity: the interned
+// index for interned ids, the string for dynamic ones.
 template<typename T>
 // NOLINTNEXTLINE(cert-dcl58-cpp)
 struct std::hash<string_id<T>> {
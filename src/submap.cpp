@@ -35,6 +35,24 @@ submap::~submap() = default;
 
 submap &submap::operator=( submap && ) noexcept = default;
 
+const std::vector<point_sm_ms> &submap::get_item_tiles() const
+{
+    if( item_tiles_dirty ) {
+        item_tiles.clear();
+        if( !is_uniform() ) {
+            for( int x = 0; x < SEEX; x++ ) {
+                for( int y = 0; y < SEEY; y++ ) {
+                    if( !m->itm[x][y].empty() ) {
+                        item_tiles.emplace_back( x, y );
+                    }
+                }
+            }
+        }
+        item_tiles_dirty = false;
+    }
+    return item_tiles;
+}
+
 void submap::clear_fields( const point_sm_ms &p )
 {
     field &f = get_field( p );
@@ -202,6 +220,7 @@ bool submap::is_open_air( const point_sm_ms &p ) const
 
 void submap::rotate( int turns )
 {
+    invalidate_item_tiles();
     if( is_uniform() ) {
         return;
     }
@@ -279,6 +298,7 @@ void submap::rotate( int turns )
 
 void submap::mirror( bool horizontally )
 {
+    invalidate_item_tiles();
     if( is_uniform() ) {
         return;
     }
@@ -324,6 +344,7 @@ void submap::mirror( bool horizontally )
 void submap::revert_submap( submap &sr )
 {
     reverted = true;
+    invalidate_item_tiles();
     if( sr.is_uniform() ) {
         m.reset();
         set_all_ter( sr.get_ter( point_sm_ms_zero ), true );
@@ -386,6 +407,7 @@ void submap::update_lum_rem( const point_sm_ms &p, const item &i )
 void submap::merge_submaps( submap *copy_from, bool copy_from_is_overlay )
 {
     this->field_count = 0;
+    invalidate_item_tiles();
 
     for( int x = 0; x < SEEX; x++ ) {
         for( int y = 0; y < SEEY; y++ ) {
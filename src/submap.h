@@ -210,6 +210,16 @@ class submap
             return m->itm[p.x()][p.y()];
         }
 
+        /**
+         * Tiles of this submap that hold items, built on demand and kept until
+         * @ref invalidate_item_tiles is called.
+         */
+        const std::vector<point_sm_ms> &get_item_tiles() const;
+        // Has to be called whenever items are added to or removed from a tile.
+        void invalidate_item_tiles() {
+            item_tiles_dirty = true;
+        }
+
         // TODO: Replace this as it essentially makes fld public
         field &get_field( const point_sm_ms &p ) {
             if( is_uniform() ) {
@@ -325,6 +335,8 @@ class submap
         std::map<point_sm_ms, tile_data> ephemeral_data;
         std::map<point_sm_ms, computer> computers;
         std::unique_ptr<maptile_soa> m;
+        mutable std::vector<point_sm_ms> item_tiles; // NOLINT(cata-serialize)
+        mutable bool item_tiles_dirty = true; // NOLINT(cata-serialize)
         ter_id uniform_ter = t_null;
         int temperature_mod = 0; // delta in F
 
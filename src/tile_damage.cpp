@@ -0,0 +1,136 @@
+#include "tile_damage.h"
+
+#include <algorithm>
+#include <cmath>
+#include <optional>
+#include <string>
+#include <utility>
+
+#include "avatar.h"
+#include "cata_utility.h"
+#include "character.h"
+#include "coordinates.h"
+#include "creature.h"
+#include "creature_tracker.h"
+#include "field.h"
+#include "hash_utils.h"
+#include "item.h"
+#include "map.h"
+#include "monster.h"
+#include "mtype.h"
+#include "submap.h"
+#include "units.h"
+#include "vehicle.h"
+#include "vpart_position.h"
+
+void tile_damage_tracker::reset()
+{
+    size = point_zero;
+    last.clear();
+}
+
+std::vector<half_open_rectangle<point>> tile_damage_tracker::update( const point &frame_size,
+                                     std::vector<std::size_t> &&fingerprints )
+{
+    std::vector<half_open_rectangle<point>> damaged;
+    if( frame_size != size || fingerprints.size() != last.size() ) {
+        if( frame_size.x > 0 && frame_size.y > 0 ) {
+            damaged.emplace_back( point_zero, frame_size );
+        }
+    } else {
+        for( int y = 0; y < size.y; ++y ) {
+            int min_x = size.x;
+            int max_x = -1;
+            for( int x = 0; x < size.x; ++x ) {
+                const std::size_t i = static_cast<std::size_t>( y * size.x + x );
+                if( fingerprints[i] != last[i] ) {
+                    min_x = std::min( min_x, x );
+                    max_x = x;
+                }
+            }
+            if( max_x < 0 ) {
+                continue;
+            }
+            if( !damaged.empty() && damaged.back().p_max.y == y ) {
+                // Grow the damage of the rows right above
+                half_open_rectangle<point> &above = damaged.back();
+                above = half_open_rectangle<point>( point( std::min( above.p_min.x, min_x ), above.p_min.y ),
+                                                    point( std::max( above.p_max.x, max_x + 1 ), y + 1 ) );
+            } else {
+                damaged.emplace_back( point( min_x, y ), point( max_x + 1, y + 1 ) );
+            }
+        }
+    }
+    size = frame_size;
+    last = std::move( fingerprints );
+    return damaged;
+}
+
+std::size_t tile_contents_fingerprint( map &here, const tripoint_bub_ms &p )
+{
+    std::size_t seed = 0;
+    const maptile tile = here.maptile_at( p );
+    cata::hash_combine( seed, tile.get_ter().to_i() );
+    cata::hash_combine( seed, tile.get_furn().to_i() );
+    cata::hash_combine( seed, tile.get_trap().to_i() );
+    cata::hash_combine( seed, tile.has_graffiti() );
+    for( const std::pair<const field_type_id, field_entry> &fd : tile.get_field() ) {
+        cata::hash_combine( seed, fd.first.to_i() );
+        cata::hash_combine( seed, fd.second.get_field_intensity() );
+    }
+    const std::size_t items = tile.get_item_count();
+    cata::hash_combine( seed, items );
+    if( items > 0 ) {
+        cata::hash_combine( seed, tile.get_uppermost_item().typeId() );
+    }
+    cata::hash_combine( seed, here.partial_con_at( p ) != nullptr );
+
+    if( const optional_vpart_position vp = here.veh_at( p ) ) {
+        const vehicle &veh = vp->vehicle();
+        cata::hash_combine( seed, &veh );
+        cata::hash_combine( seed, std::lround( units::to_degrees( veh.face.dir() ) ) );
+        if( const std::optional<vpart_reference> part = vp->part_displayed() ) {
+            cata::hash_combine( seed, part->part_index() );
+            cata::hash_combine( seed, part->part().is_broken() );
+            cata::hash_combine( seed, part->part().open );
+            cata::hash_combine( seed, part->items().size() );
+        }
+    }
+
+    if( const Creature *critter = get_creature_tracker().creature_at( p, true ) ) {
+        cata::hash_combine( seed, critter );
+        cata::hash_combine( seed, static_cast<int>( critter->facing ) );
+        cata::hash_combine( seed, get_avatar().sees( *critter ) );
+        if( const monster *mon = critter->as_monster() ) {
+            cata::hash_combine( seed, mon->type->id );
+        } else if( const Character *ch = critter->as_character() ) {
+            // Worn and wielded items, mutations and effects all show on characters
+            for( const std::pair<std::string, std::string> &overlay : ch->get_overlay_ids() ) {
+                cata::hash_combine( seed, overlay.first );
+                cata::hash_combine( seed, overlay.second );
+            }
+        }
+    }
+    return seed;
+}
+
+half_open_rectangle<point> tile_sprite_area( const half_open_rectangle<point> &tiles,
+        const point &tile_size, const half_open_rectangle<point> &sprite_extent )
+{
+    return half_open_rectangle<point>(
+               point( tiles.p_min.x * tile_size.x, tiles.p_min.y * tile_size.y ) + sprite_extent.p_min,
+               point( ( tiles.p_max.x - 1 ) * tile_size.x,
+                      ( tiles.p_max.y - 1 ) * tile_size.y ) + sprite_extent.p_max );
+}
+
+half_open_rectangle<point> tiles_covering( const half_open_rectangle<point> &area,
+        const point &tile_size, const half_open_rectangle<point> &sprite_extent )
+{
+    // A tile covers [ col * width + extent min, col * width + extent max ) on
+    // each axis, so it overlaps the area if that interval overlaps the area's.
+    return half_open_rectangle<point>(
+               point( divide_round_down( area.p_min.x - sprite_extent.p_max.x, tile_size.x ) + 1,
+                      divide_round_down( area.p_min.y - sprite_extent.p_max.y, tile_size.y ) + 1 ),
+               point( -divide_round_down( sprite_extent.p_min.x - area.p_max.x, tile_size.x ),
+                      -divide_round_down( sprite_extent.p_min.y - area.p_max.y, tile_size.y ) ) );
+}
@@ -0,0 +1,55 @@
+#pragma once
+#ifndef CATA_SRC_TILE_DAMAGE_H
+#define CATA_SRC_TILE_DAMAGE_H
+
+#include <cstddef>
+#include <vector>
+
+#include "coords_fwd.h"
+#include "cuboid_rectangle.h"
+#include "point.h"
+
+class map;
+
+/**
+ * Remembers what every tile of the terrain view looked like when it was last
+ * drawn, as one fingerprint per tile, so the next frame only has to repaint
+ * the tiles whose fingerprint changed.
+ */
+class tile_damage_tracker
+{
+    public:
+        /** Forget the last frame, so the next update damages every tile. */
+        void reset();
+        /**
+         * Record the fingerprints of a frame `frame_size` tiles large, indexed
+         * by `y * frame_size.x + x`, and return the tiles that differ from the
+         * last frame as half open rectangles of consecutive rows. After a reset
+         * or when the frame size changed, that is the whole frame.
+         */
+        std::vector<half_open_rectangle<point>> update( const point &frame_size,
+                                             std::vector<std::size_t> &&fingerprints );
+    private:
+        point size;
+        std::vector<std::size_t> last;
+};
+
+/**
+ * Fingerprint of what a map tile shows: terrain, furniture, trap, fields,
+ * items, vehicle part and creature. Changes whenever the tile would be drawn
+ * differently, not counting lighting and visibility.
+ */
+std::size_t tile_contents_fingerprint( map &here, const tripoint_bub_ms &p );
+
+/**
+ * Pixels that sprites drawn on `tiles` may cover, relative to the corner of the
+ * tile in column and row zero, for sprites that reach `sprite_extent` around
+ * the corner of their tile.
+ */
+half_open_rectangle<point> tile_sprite_area( const half_open_rectangle<point> &tiles,
+        const point &tile_size, const half_open_rectangle<point> &sprite_extent );
+/** The tiles whose sprites may cover part of `area`, see `tile_sprite_area`. */
+half_open_rectangle<point> tiles_covering( const half_open_rectangle<point> &area,
+        const point &tile_size, const half_open_rectangle<point> &sprite_extent );
+
+#endif // CATA_SRC_TILE_DAMAGE_H
@@ -1,17 +1,24 @@
 #include "ui_manager.h"
 
+#include <algorithm>
+#include <chrono>
 #include <functional>
 #include <iterator>
 #include <optional>
+#include <string>
 #include <vector>
 
 #include "cached_options.h"
 #include "cata_assert.h"
 #include "cata_scope_helpers.h"
 #include "cata_utility.h"
+#include "catacharset.h"
+#include "color.h"
 #include "cursesdef.h"
 #include "game_ui.h"
+#include "output.h"
 #include "point.h"
+#include "string_formatter.h"
 #include "sdltiles.h" // IWYU pragma: keep
 #include "cata_imgui.h"
 
@@ -30,6 +37,13 @@ static std::optional<SDL_Rect> prev_clip_rect;
 #endif
 static ui_stack_t ui_stack;
 
+// Summary of the last redraw, for the redraw cost overlay
+static int last_redrawn = 0;
+static int last_skipped = 0;
+static std::chrono::microseconds last_redraw_time{ 0 };
+// Screen area covered by the overlay when it was last drawn
+static std::optional<rectangle<point>> redraw_overlay_area;
+
 ui_adaptor::ui_adaptor() : is_imgui( false ), disabling_uis_below( false ),
     is_debug_message_ui( false ),
     invalidated( false ), deferred_resize( false )
@@ -114,6 +128,7 @@ void ui_adaptor::position_from_window( const catacurses::window &win )
         const point origin( getbegx( win ), getbegy( win ) );
         dimensions = rectangle<point>( origin, origin + point( getmaxx( win ), getmaxy( win ) ) );
 #endif
+        damage = dimensions;
         invalidated = true;
         ui_manager::invalidate( old_dimensions, false );
     }
@@ -130,6 +145,7 @@ void ui_adaptor::position( const point &topleft, const point &size )
 #else
     dimensions = rectangle<point>( topleft, topleft + size );
 #endif
+    damage = dimensions;
     invalidated = true;
     ui_manager::invalidate( old_dimensions, false );
 }
@@ -139,6 +155,7 @@ void ui_adaptor::position_absolute( const point &topleft, const point &size )
     const rectangle<point> old_dimensions = dimensions;
     // ensure position is updated before calling invalidate
     dimensions = rectangle<point>( topleft, topleft + size );
+    damage = dimensions;
     invalidated = true;
     ui_manager::invalidate( old_dimensions, false );
 }
@@ -230,9 +247,44 @@ static bool overlap( const rectangle<point> &lhs, const rectangle<point> &rhs )
            rhs.p_min.x < lhs.p_max.x && rhs.p_min.y < lhs.p_max.y;
 }
 
+void ui_adaptor::add_damage( const rectangle<point> &rect ) const
+{
+    const rectangle<point> area( point( std::max( rect.p_min.x, dimensions.p_min.x ),
+                                        std::max( rect.p_min.y, dimensions.p_min.y ) ),
+                                 point( std::min( rect.p_max.x, dimensions.p_max.x ),
+                                        std::min( rect.p_max.y, dimensions.p_max.y ) ) );
+    if( area.p_min.x >= area.p_max.x || area.p_min.y >= area.p_max.y ) {
+        return;
+    }
+    if( damage ) {
+        damage = rectangle<point>( point( std::min( damage->p_min.x, area.p_min.x ),
+                                          std::min( damage->p_min.y, area.p_min.y ) ),
+                                   point( std::max( damage->p_max.x, area.p_max.x ),
+                                          std::max( damage->p_max.y, area.p_max.y ) ) );
+    } else {
+        damage = area;
+    }
+    invalidated = true;
+}
+
+rectangle<point> ui_adaptor::repainted_area() const
+{
+    if( partial_redraw && !contents_changed && damage ) {
+        return *damage;
+    }
+    return dimensions;
+}
+
+void ui_adaptor::clear_invalidation() const
+{
+    invalidated = false;
+    contents_changed = false;
+    damage.reset();
+}
+
 // This function does two things:
 // 1. Ensure that any UI that would be overwritten by redrawing a lower invalidated
-//    UI also gets redrawn.
+//    UI also gets redrawn, in the part that gets overwritten.
 // 2. Optimize the invalidated flag so completely occluded UIs will not be redrawn.
 //
 // The current implementation may still invalidate UIs that in fact do not need to
@@ -255,15 +307,17 @@ void ui_adaptor::invalidation_consistency_and_optimization()
         const ui_adaptor &ui_upper = it_upper->get();
         for( auto it_lower = first; it_lower < it_upper; ++it_lower ) {
             const ui_adaptor &ui_lower = it_lower->get();
-            if( !ui_upper.invalidated && ui_lower.invalidated &&
-                overlap( ui_upper.dimensions, ui_lower.dimensions ) ) {
-                // invalidated by lower invalidated UIs
-                ui_upper.invalidated = true;
+            if( ui_lower.invalidated ) {
+                const rectangle<point> repainted = ui_lower.repainted_area();
+                if( overlap( ui_upper.dimensions, repainted ) ) {
+                    // invalidated by lower invalidated UIs
+                    ui_upper.add_damage( repainted );
+                }
             }
             if( ui_upper.invalidated && ui_lower.invalidated &&
                 contains( ui_upper.dimensions, ui_lower.dimensions ) ) {
                 // fully obscured lower UIs do not need to be redrawn.
-                ui_lower.invalidated = false;
+                ui_lower.clear_invalidation();
                 // Note: we don't need to re-test ui_lower from earlier iterations
                 // during which ui_upper.invalidated hadn't yet been determined to
                 // be true, because if the ui_lower would be obscured by ui_upper,
@@ -277,7 +331,7 @@ void ui_adaptor::invalidation_consistency_and_optimization()
 
 void ui_adaptor::invalidate_ui() const
 {
-    if( invalidated ) {
+    if( invalidated && contents_changed ) {
         return;
     }
     auto it = ui_stack.cbegin();
@@ -299,9 +353,15 @@ void ui_adaptor::invalidate_ui() const
     // `disable_uis_below`, so when the UI with `disable_uis_below` is removed,
     // this UI is correctly marked for redraw.
     invalidated = true;
+    contents_changed = true;
     invalidation_consistency_and_optimization();
 }
 
+void ui_adaptor::enable_partial_redraw()
+{
+    partial_redraw = true;
+}
+
 void ui_adaptor::reset()
 {
     on_screen_resize( nullptr );
@@ -327,9 +387,9 @@ void ui_adaptor::invalidate( const rectangle<point> &rect, const bool reenable_u
     // UIs below are correctly marked for redraw.
     for( auto it_upper = ui_stack.cbegin(); it_upper < ui_stack.cend(); ++it_upper ) {
         const ui_adaptor &ui_upper = it_upper->get();
-        if( !ui_upper.invalidated && overlap( ui_upper.dimensions, rect ) ) {
+        if( overlap( ui_upper.dimensions, rect ) ) {
             // invalidated by `rect`
-            ui_upper.invalidated = true;
+            ui_upper.add_damage( rect );
         }
     }
     invalidation_consistency_and_optimization();
@@ -348,14 +408,23 @@ bool ui_adaptor::has_imgui()
 void ui_adaptor::redraw()
 {
     if( !ui_stack.empty() ) {
-        ui_stack.back().get().invalidated = true;
+        const ui_adaptor &ui = ui_stack.back();
+        ui.invalidated = true;
+        ui.contents_changed = true;
     }
     redraw_invalidated();
 }
 
 void ui_adaptor::redraw_invalidated( )
 {
-    if( test_mode || ui_stack.empty() ) {
+    if( test_mode ) {
+        // Nothing is drawn in tests, but the invalidated UIs count as redrawn
+        for( const ui_adaptor &ui : ui_stack ) {
+            ui.clear_invalidation();
+        }
+        return;
+    }
+    if( ui_stack.empty() ) {
         return;
     }
     // This boolean is needed when a debug error is thrown inside redraw_invalidated
@@ -364,6 +433,13 @@ void ui_adaptor::redraw_invalidated( )
     }
     imgui_frame_started = true;
 
+    const std::chrono::steady_clock::time_point redraw_start = std::chrono::steady_clock::now();
+    if( redraw_overlay_area ) {
+        // Let the UIs below repaint the area, the overlay may shrink or be turned off
+        invalidate( *redraw_overlay_area, false );
+        redraw_overlay_area.reset();
+    }
+
     restore_on_out_of_scope<bool> prev_redraw_in_progress( redraw_in_progress );
     restore_on_out_of_scope<bool> prev_restart_redrawing( restart_redrawing );
     redraw_in_progress = true;
@@ -439,13 +515,35 @@ void ui_adaptor::redraw_invalidated( )
             }
             std::optional<point> cursor_pos;
             auto top_ui = std::prev( ui_stack_orig->end() );
+            last_redrawn = 0;
+            last_skipped = 0;
             for( auto it = first_enabled; !restart_redrawing && it != ui_stack_orig->end(); ++it ) {
                 ui_adaptor &ui = *it;
                 ui.is_on_top = it == top_ui;
                 if( ui.invalidated || ui.is_imgui ) {
                     if( ui.redraw_cb ) {
                         ui.default_cursor();
+                        const std::chrono::steady_clock::time_point start =
+                            std::chrono::steady_clock::now();
+#if defined( TILES )
+                        // Keep a partial redraw from painting over the UIs above it
+                        const bool clipped = ui.partial_redraw && !ui.contents_changed && ui.damage;
+                        if( clipped ) {
+                            const SDL_Rect clip{ ui.damage->p_min.x, ui.damage->p_min.y,
+                                                 ui.damage->p_max.x - ui.damage->p_min.x,
+                                                 ui.damage->p_max.y - ui.damage->p_min.y };
+                            SDL_RenderSetClipRect( get_sdl_renderer().get(), &clip );
+                        }
+#endif
                         ui.redraw_cb( ui );
+#if defined( TILES )
+                        if( clipped ) {
+                            SDL_RenderSetClipRect( get_sdl_renderer().get(), nullptr );
+                        }
+#endif
+                        ui.cost.add( std::chrono::duration_cast<std::chrono::microseconds>(
+                                         std::chrono::steady_clock::now() - start ) );
+                        last_redrawn++;
                         if( ui.cursor_type == cursor::last ) {
                             ui.record_term_cursor();
                             cata_assert( ui.cursor_type != cursor::last );
@@ -455,8 +553,10 @@ void ui_adaptor::redraw_invalidated( )
                         }
                     }
                     if( !restart_redrawing ) {
-                        ui.invalidated = false;
+                        ui.clear_invalidation();
                     }
+                } else {
+                    last_skipped++;
                 }
             }
             if( !restart_redrawing && cursor_pos.has_value() ) {
@@ -464,6 +564,11 @@ void ui_adaptor::redraw_invalidated( )
             }
         }
     } while( restart_redrawing );
+    last_redraw_time = std::chrono::duration_cast<std::chrono::microseconds>(
+                           std::chrono::steady_clock::now() - redraw_start );
+    if( ui_redraw_overlay ) {
+        draw_redraw_cost_overlay();
+    }
 #if defined(EMSCRIPTEN)
     emscripten_sleep( 1 );
 #endif
@@ -478,6 +583,61 @@ void ui_adaptor::redraw_invalidated( )
     }
 }
 
+void ui_adaptor::redraw_cost::add( const std::chrono::microseconds time )
+{
+    redraws++;
+    last = time;
+    total += time;
+}
+
+std::chrono::microseconds ui_adaptor::redraw_cost::average() const
+{
+    return redraws == 0 ? std::chrono::microseconds( 0 ) : total / redraws;
+}
+
+std::vector<std::string> ui_adaptor::redraw_cost_report()
+{
+    std::vector<std::string> lines;
+    lines.emplace_back( string_format( "redraw %d us, %d redrawn, %d skipped",
+                                       static_cast<int>( last_redraw_time.count() ), last_redrawn, last_skipped ) );
+    for( auto it = ui_stack.rbegin(); it != ui_stack.rend(); ++it ) {
+        const ui_adaptor &ui = *it;
+        const point size = ui.dimensions.p_max - ui.dimensions.p_min;
+        lines.emplace_back( string_format( "%dx%d at %d,%d: last %d us, avg %d us, %d redraws",
+                                           size.x, size.y, ui.dimensions.p_min.x, ui.dimensions.p_min.y,
+                                           static_cast<int>( ui.cost.last.count() ),
+                                           static_cast<int>( ui.cost.average().count() ), ui.cost.redraws ) );
+    }
+    return lines;
+}
+
+void ui_adaptor::draw_redraw_cost_overlay()
+{
+    const std::vector<std::string> lines = redraw_cost_report();
+    int width = 0;
+    for( const std::string &line : lines ) {
+        width = std::max( width, utf8_width( line ) );
+    }
+    width = std::min( width, TERMX );
+    const int height = std::min( static_cast<int>( lines.size() ), TERMY );
+    if( width <= 0 || height <= 0 ) {
+        return;
+    }
+    const catacurses::window w = catacurses::newwin( height, width, point( TERMX - width, 0 ) );
+    werase( w );
+    for( int i = 0; i < height; i++ ) {
+        mvwprintz( w, point( 0, i ), c_yellow, lines[i] );
+    }
+    wnoutrefresh( w );
+#ifdef TILES
+    const window_dimensions dim = get_window_dimensions( w );
+    redraw_overlay_area = rectangle<point>( dim.window_pos_pixel,
+                                            dim.window_pos_pixel + dim.window_size_pixel );
+#else
+    redraw_overlay_area = rectangle<point>( point( TERMX - width, 0 ), point( TERMX, height ) );
+#endif
+}
+
 void ui_adaptor::screen_resized()
 {
     // Always mark every UI for resize even if it is below another UI with
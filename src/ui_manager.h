@@ -2,7 +2,11 @@
 #ifndef CATA_SRC_UI_MANAGER_H
 #define CATA_SRC_UI_MANAGER_H
 
+#include <chrono>
 #include <functional>
+#include <optional>
+#include <string>
+#include <vector>
 
 #include "cuboid_rectangle.h"
 #include "point.h"
@@ -216,6 +220,32 @@ class ui_adaptor
          **/
         void invalidate_ui() const;
 
+        /**
+         * Let the redraw callback repaint only the damaged region when the UI
+         * is redrawn because part of it was uncovered, and not because its
+         * contents changed. UIs above are then only redrawn where they overlap
+         * that region. On tiles the drawing is clipped to the damaged region,
+         * so only enable this if the redraw callback draws through SDL.
+         **/
+        void enable_partial_redraw();
+        /**
+         * Bounding rectangle of the screen area of this UI whose pixels were
+         * lost since it was last drawn, by moving or resizing it, or by closing
+         * or moving a UI above it. Uses the same coordinates as the UI position.
+         * Only meaningful in the redraw callback.
+         **/
+        const std::optional<rectangle<point>> &damaged_region() const {
+            return damage;
+        }
+        /**
+         * Whether the UI is redrawn because its contents may have changed
+         * (`invalidate_ui` or `redraw`), and not only because part of it was
+         * uncovered. Only meaningful in the redraw callback.
+         **/
+        bool contents_invalidated() const {
+            return contents_changed;
+        }
+
         /**
          * Reset all callbacks and dimensions. Will cause invalidation of the
          * previously specified screen area.
@@ -224,6 +254,24 @@ class ui_adaptor
 
         void shutdown();
 
+        /** Time spent in the redraw callback of a UI. */
+        struct redraw_cost {
+            int redraws = 0;
+            std::chrono::microseconds last{ 0 };
+            std::chrono::microseconds total{ 0 };
+
+            void add( std::chrono::microseconds time );
+            std::chrono::microseconds average() const;
+        };
+        const redraw_cost &get_redraw_cost() const {
+            return cost;
+        }
+        /**
+         * One line per UI on the stack, topmost first, with its size and redraw cost, after a
+         * line summing up the last redraw. Shown by the UI_REDRAW_OVERLAY debug option.
+         */
+        static std::vector<std::string> redraw_cost_report();
+
         /* See the `ui_manager` namespace */
         static void invalidate( const rectangle<point> &rect, bool reenable_uis_below );
         static bool has_imgui();
@@ -232,6 +280,12 @@ class ui_adaptor
         static void screen_resized();
     private:
         static void invalidation_consistency_and_optimization();
+        static void draw_redraw_cost_overlay();
+        // Mark part of the UI for repainting, clipped to its dimensions
+        void add_damage( const rectangle<point> &rect ) const;
+        // Screen area the redraw callback is going to repaint
+        rectangle<point> repainted_area() const;
+        void clear_invalidation() const;
 
         // pixel dimensions in tiles, console cell dimensions in curses
         rectangle<point> dimensions;
@@ -254,6 +308,12 @@ class ui_adaptor
 
         mutable bool invalidated;
         mutable bool deferred_resize;
+        // Whether `invalidated` was set for the contents and not only for `damage`
+        mutable bool contents_changed = false;
+        mutable std::optional<rectangle<point>> damage;
+        bool partial_redraw = false;
+
+        redraw_cost cost;
 };
 
 /**
@@ -719,6 +719,7 @@ std::list<item> map_cursor::remove_items_with( const
         if( filter( *iter ) ) {
             // if necessary remove item from the luminosity map
             sub->update_lum_rem( offset, *iter );
+            sub->invalidate_item_tiles();
 
             // finally remove the item
             res.push_back( *iter );
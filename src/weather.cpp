@@ -68,6 +68,8 @@ static const oter_type_str_id oter_type_forest_water( "forest_water" );
 static const trait_id trait_CEPH_VISION( "CEPH_VISION" );
 static const trait_id trait_FEATHERS( "FEATHERS" );
 
+static const option_handle<std::string> option_ETERNAL_WEATHER( "ETERNAL_WEATHER" );
+
 /**
  * \defgroup Weather "Weather and its implications."
  * @{
@@ -905,7 +907,7 @@ void weather_manager::update_weather()
         w = weather_gen.get_weather( player_character.get_location(), calendar::turn,
                                      g->get_seed() );
         weather_type_id old_weather = weather_id;
-        std::string eternal_weather_option = get_option<std::string>( "ETERNAL_WEATHER" );
+        const std::string &eternal_weather_option = option_ETERNAL_WEATHER.get();
         if( eternal_weather_option != "normal" ) {
             weather_id = static_cast<weather_type_id>( eternal_weather_option );
         } else if( weather_override == WEATHER_NULL ) {
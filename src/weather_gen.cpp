@@ -35,16 +35,111 @@ constexpr double noise_magnitude_K = 8;
 // Greatest absolute day-to-day noise, in kelvins
 } //namespace
 
+static bool weather_noise_memo_enabled = true;
+
+weather_noise_memo &get_weather_noise_memo()
+{
+    static weather_noise_memo memo;
+    return memo;
+}
+
+void weather_noise_memo::set_enabled( bool enabled )
+{
+    weather_noise_memo_enabled = enabled;
+    get_weather_noise_memo().clear();
+}
+
+bool weather_noise_memo::is_enabled()
+{
+    return weather_noise_memo_enabled;
+}
+
+void weather_noise_memo::clear()
+{
+    chunks.clear();
+}
+
+weather_noise_memo::sample weather_noise_memo::evaluate( const tripoint &location,
+        const time_point &t, unsigned mod_seed )
+{
+    // Integer x position / widening factor of the Perlin function.
+    const double x = location.x / 2000.0;
+    // Integer y position / widening factor of the Perlin function.
+    const double y = location.y / 2000.0;
+    // Integer turn / widening factor of the Perlin function.
+    const double z = to_days<double>( t - calendar::turn_zero );
+    sample result;
+    result.temperature = raw_noise_4d( x, y, z, mod_seed );
+    result.wind = raw_noise_4d( x / 2.5, y / 2.5, z / 200, mod_seed );
+    result.humidity = raw_noise_4d( x, y, z, mod_seed + 101 );
+    result.pressure = raw_noise_4d( x, y, z, mod_seed + 211 );
+    return result;
+}
+
+weather_noise_memo::sample weather_noise_memo::get( const point_abs_omt &location, int hour,
+        unsigned mod_seed )
+{
+    if( mod_seed != seed ) {
+        clear();
+        seed = mod_seed;
+    }
+    const point chunk_pos( divide_round_to_minus_infinity( location.x(), chunk_size ),
+                           divide_round_to_minus_infinity( location.y(), chunk_size ) );
+    const std::tuple<int, int, int> key( chunk_pos.x, chunk_pos.y, hour );
+    auto iter = chunks.find( key );
+    if( iter == chunks.end() ) {
+        if( chunks.size() >= max_chunks ) {
+            chunks.clear();
+        }
+        iter = chunks.emplace( key, chunk() ).first;
+    }
+    chunk &c = iter->second;
+    const size_t index = ( location.y() - chunk_pos.y * chunk_size ) * chunk_size +
+                         location.x() - chunk_pos.x * chunk_size;
+    if( c.present[index] ) {
+        stats.hits++;
+        return c.samples[index];
+    }
+    stats.misses++;
+    const tripoint_abs_ms corner( project_to<coords::ms>( location ), 0 );
+    const time_point start_of_hour = calendar::turn_zero + time_duration::from_hours( hour );
+    c.samples[index] = evaluate( corner.raw(), start_of_hour, mod_seed );
+    c.present.set( index );
+    return c.samples[index];
+}
+
+// Noise for the map square and time, from the memo when it is enabled
+static weather_noise_memo::sample get_noise( const tripoint &location, const time_point &t,
+        unsigned mod_seed )
+{
+    if( !weather_noise_memo::is_enabled() ) {
+        return weather_noise_memo::evaluate( location, t, mod_seed );
+    }
+    weather_noise_memo &memo = get_weather_noise_memo();
+    const point_abs_omt omt = project_to<coords::omt>( point_abs_ms( location.xy() ) );
+    const double hours = to_hours<double>( t - calendar::turn_zero );
+    const int hour = static_cast<int>( std::floor( hours ) );
+    const double fraction = hours - hour;
+    const weather_noise_memo::sample before = memo.get( omt, hour, mod_seed );
+    if( fraction == 0 ) {
+        return before;
+    }
+    const weather_noise_memo::sample after = memo.get( omt, hour + 1, mod_seed );
+    weather_noise_memo::sample result;
+    result.temperature = before.temperature + ( after.temperature - before.temperature ) * fraction;
+    result.humidity = before.humidity + ( after.humidity - before.humidity ) * fraction;
+    result.pressure = before.pressure + ( after.pressure - before.pressure ) * fraction;
+    result.wind = before.wind + ( after.wind - before.wind ) * fraction;
+    return result;
+}
+
 weather_generator::weather_generator() = default;
 int weather_generator::current_winddir = 1000;
 
 struct weather_gen_common {
-    double x = 0;
-    double y = 0;
-    double z = 0;
     double cyf = 0;
-    unsigned modSEED = 0u;
     season_type season = season_type::SPRING;
+    weather_noise_memo::sample noise;
 };
 
 static weather_gen_common get_common_data( const tripoint &location, const time_point &real_t,
@@ -52,15 +147,10 @@ static weather_gen_common get_common_data( const tripoint &location, const time_
 {
     season_effective_time t( real_t );
     weather_gen_common result;
-    // Integer x position / widening factor of the Perlin function.
-    result.x = location.x / 2000.0;
-    // Integer y position / widening factor of the Perlin function.
-    result.y = location.y / 2000.0;
-    // Integer turn / widening factor of the Perlin function.
-    result.z = to_days<double>( real_t - calendar::turn_zero );
     // Limit the random seed during noise calculation, a large value flattens the noise generator to zero
     // Windows has a rand limit of 32768, other operating systems can have higher limits
-    result.modSEED = seed % SIMPLEX_NOISE_RANDOM_SEED_LIMIT;
+    const unsigned modSEED = seed % SIMPLEX_NOISE_RANDOM_SEED_LIMIT;
+    result.noise = get_noise( location, real_t, modSEED );
     const double year_fraction( time_past_new_year( t.t ) /
                                 calendar::year_length() ); // [0,1)
 
@@ -77,11 +167,6 @@ static weather_gen_common get_common_data( const tripoint &location, const time_
 static units::temperature weather_temperature_from_common_data( const weather_generator &wg,
         const weather_gen_common &common, const season_effective_time &t )
 {
-    const double x( common.x );
-    const double y( common.y );
-    const double z( common.z );
-
-    const unsigned modSEED = common.modSEED;
     const double seasonality = -common.cyf;
     // -1 in midwinter, +1 in midsummer
     const season_type season = common.season;
@@ -100,7 +185,7 @@ static units::temperature weather_temperature_from_common_data( const weather_ge
         dayv * daily_magnitude_K +
         seasonality * seasonality_magnitude_K );
 
-    const double T = baseline + raw_noise_4d( x, y, z, modSEED ) * noise_magnitude_K;
+    const double T = baseline + common.noise.temperature * noise_magnitude_K;
 
     return units::from_celsius( T );
 }
@@ -117,11 +202,6 @@ w_point weather_generator::get_weather( const tripoint_abs_ms &location, const t
     season_effective_time t( real_t );
     const weather_gen_common common = get_common_data( location.raw(), real_t, seed );
 
-    const double x( common.x );
-    const double y( common.y );
-    const double z( common.z );
-
-    const unsigned modSEED = common.modSEED;
     const double cyf( common.cyf );
     const double seasonality = -common.cyf;
     // -1 in midwinter, +1 in midsummer
@@ -129,7 +209,7 @@ w_point weather_generator::get_weather( const tripoint_abs_ms &location, const t
 
     // Noise factors
     const units::temperature T( weather_temperature_from_common_data( *this, common, t ) );
-    double W( raw_noise_4d( x / 2.5, y / 2.5, z / 200, modSEED ) * 10.0 );
+    double W( common.noise.wind * 10.0 );
 
     // Humidity variation
     double mod_h( 0 );
@@ -146,13 +226,13 @@ w_point weather_generator::get_weather( const tripoint_abs_ms &location, const t
     double H = std::min( 100., std::max( 0.,
                                          base_humidity + mod_h + 100 * (
                                                  .15 * seasonality +
-                                                 raw_noise_4d( x, y, z, modSEED + 101 ) *
+                                                 common.noise.humidity *
                                                  .2 * ( -seasonality + 2 ) ) ) );
 
     // Pressure
     double P =
         base_pressure +
-        raw_noise_4d( x, y, z, modSEED + 211 ) *
+        common.noise.pressure *
         10 * ( -seasonality + 2 );
 
     // Wind power
@@ -2,12 +2,17 @@
 #ifndef CATA_SRC_WEATHER_GEN_H
 #define CATA_SRC_WEATHER_GEN_H
 
+#include <array>
+#include <bitset>
 #include <iosfwd>
 #include <map>
+#include <tuple>
+#include <unordered_map>
 #include <vector>
 
 #include "calendar.h"
 #include "coordinates.h"
+#include "hash_utils.h"
 #include "type_id.h"
 #include "units.h"
 
@@ -25,6 +30,68 @@ struct w_point {
     tripoint_abs_ms location;
 };
 
+/**
+ * Memo of the noise the weather generator samples for a place and time.
+ *
+ * The noise fields change slowly, over thousands of map squares and over hours, but item
+ * temperature processing, the weather at the avatar, plant growth and the overmap weather display
+ * evaluate them for many nearby places and for the same hours, four simplex noise calls each time.
+ * The memo samples the fields once per overmap terrain and hour; weather_generator interpolates
+ * between the hours around the requested time. The noise doesn't depend on the region's weather
+ * settings, so one memo serves every weather_generator.
+ *
+ * Samples are kept in chunks of chunk_size x chunk_size overmap terrains per hour, all of them
+ * dropped once there are more than max_chunks.
+ */
+class weather_noise_memo
+{
+    public:
+        struct sample {
+            double temperature = 0;
+            double humidity = 0;
+            double pressure = 0;
+            double wind = 0;
+        };
+
+        struct counters {
+            int hits = 0;
+            int misses = 0;
+        };
+
+        /** Noise at the corner of the overmap terrain at the start of the hour. */
+        sample get( const point_abs_omt &location, int hour, unsigned mod_seed );
+        /** Noise at exactly the given map square and time. */
+        static sample evaluate( const tripoint &location, const time_point &t, unsigned mod_seed );
+
+        void clear();
+
+        const counters &get_counters() const {
+            return stats;
+        }
+        void reset_counters() {
+            stats = counters();
+        }
+
+        /** Test hook: when disabled every sample is evaluated from scratch and nothing is kept. */
+        static void set_enabled( bool enabled );
+        static bool is_enabled();
+
+        static constexpr int chunk_size = 8;
+        static constexpr size_t max_chunks = 1024;
+
+    private:
+        struct chunk {
+            std::array<sample, chunk_size * chunk_size> samples;
+            std::bitset<chunk_size * chunk_size> present;
+        };
+        // Chunk x, chunk y, hour
+        std::unordered_map<std::tuple<int, int, int>, chunk, cata::tuple_hash> chunks;
+        unsigned seed = 0;
+        counters stats;
+};
+
+weather_noise_memo &get_weather_noise_memo();
+
 class weather_generator
 {
     public:
@@ -0,0 +1,240 @@
+#include "worker_pool.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <deque>
+
+#include "debug.h"
+#include "point.h"
+#include "rng.h"
+
+static bool force_serial = false;
+
+worker_pool::worker_pool( int extra_threads )
+{
+    for( int i = 0; i <= extra_threads; i++ ) {
+        ranges.emplace_back( std::make_unique<task_range>() );
+    }
+    for( int i = 1; i <= extra_threads; i++ ) {
+        threads.emplace_back( &worker_pool::work, this, i );
+    }
+}
+
+worker_pool::~worker_pool()
+{
+    {
+        std::lock_guard<std::mutex> lock( mutex );
+        stopping = true;
+    }
+    wake_workers.notify_all();
+    for( std::thread &t : threads ) {
+        t.join();
+    }
+}
+
+bool worker_pool::next_task( int worker, int &task )
+{
+    task_range &own = *ranges[worker];
+    {
+        std::lock_guard<std::mutex> lock( own.mutex );
+        if( own.begin < own.end ) {
+            task = own.begin++;
+            return true;
+        }
+    }
+    // Steal the back half of the first other worker that has tasks left
+    const int workers = size();
+    for( int i = 1; i < workers; i++ ) {
+        task_range &victim = *ranges[( worker + i ) % workers];
+        int begin;
+        int end;
+        {
+            std::lock_guard<std::mutex> lock( victim.mutex );
+            if( victim.begin >= victim.end ) {
+                continue;
+            }
+            begin = victim.begin + ( victim.end - victim.begin ) / 2;
+            end = victim.end;
+            victim.end = begin;
+        }
+        std::lock_guard<std::mutex> lock( own.mutex );
+        task = begin;
+        own.begin = begin + 1;
+        own.end = end;
+        return true;
+    }
+    return false;
+}
+
+void worker_pool::do_tasks( int worker )
+{
+    int task = 0;
+    while( next_task( worker, task ) ) {
+        ( *job )( task, worker );
+    }
+}
+
+void worker_pool::work( int worker )
+{
+    unsigned seen_generation = 0;
+    while( true ) {
+        {
+            std::unique_lock<std::mutex> lock( mutex );
+            wake_workers.wait( lock, [&]() {
+                return stopping || generation != seen_generation;
+            } );
+            if( stopping ) {
+                return;
+            }
+            seen_generation = generation;
+        }
+        do_tasks( worker );
+        {
+            std::lock_guard<std::mutex> lock( mutex );
+            busy_workers--;
+        }
+        job_done.notify_one();
+    }
+}
+
+void worker_pool::run( int tasks, const std::function<void( int, int )> &func )
+{
+    if( force_serial || threads.empty() || tasks <= 1 || running.exchange( true ) ) {
+        for( int task = 0; task < tasks; task++ ) {
+            func( task, 0 );
+        }
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> lock( mutex );
+        job = &func;
+        const int workers = size();
+        for( int worker = 0; worker < workers; worker++ ) {
+            task_range &range = *ranges[worker];
+            std::lock_guard<std::mutex> range_lock( range.mutex );
+            range.begin = tasks * worker / workers;
+            range.end = tasks * ( worker + 1 ) / workers;
+        }
+        busy_workers = static_cast<int>( threads.size() );
+        generation++;
+    }
+    wake_workers.notify_all();
+    do_tasks( 0 );
+    {
+        std::unique_lock<std::mutex> lock( mutex );
+        job_done.wait( lock, [this]() {
+            return busy_workers == 0;
+        } );
+        job = nullptr;
+    }
+    running = false;
+}
+
+void worker_pool::run_seeded( int tasks, const rng_stream &stream,
+                              const std::function<void( int, int )> &func )
+{
+    run( tasks, [&]( int task, int worker ) {
+        rng_stream task_stream = stream.fork( static_cast<std::uint64_t>( task ) );
+        rng_stream_scope scope( task_stream );
+        func( task, worker );
+    } );
+}
+
+void worker_pool::parallel_for( const point &size,
+                                const std::function<void( const point &, int )> &func )
+{
+    if( size.x <= 0 || size.y <= 0 ) {
+        return;
+    }
+    run( size.x * size.y, [&]( int task, int worker ) {
+        func( point( task % size.x, task / size.x ), worker );
+    } );
+}
+
+void worker_pool::set_serial( bool serial )
+{
+    force_serial = serial;
+}
+
+bool worker_pool::is_serial()
+{
+    return force_serial;
+}
+
+worker_pool &get_worker_pool()
+{
+    static worker_pool pool( std::max( 1U, std::thread::hardware_concurrency() ) - 1 );
+    return pool;
+}
+
+task_graph::task_id task_graph::add( const std::function<void( int )> &func )
+{
+    nodes.emplace_back();
+    nodes.back().func = func;
+    return static_cast<task_id>( nodes.size() ) - 1;
+}
+
+void task_graph::depends( task_id task, task_id before )
+{
+    nodes[before].dependents.push_back( task );
+    nodes[task].dependencies++;
+}
+
+bool task_graph::run( worker_pool &pool ) const
+{
+    const int total = static_cast<int>( nodes.size() );
+    std::vector<int> waiting_for( total );
+    std::deque<task_id> ready;
+    for( task_id task = 0; task < total; task++ ) {
+        waiting_for[task] = nodes[task].dependencies;
+        if( waiting_for[task] == 0 ) {
+            ready.push_back( task );
+        }
+    }
+
+    // Check for cycles first, a task in one would never become ready
+    {
+        std::vector<int> check = waiting_for;
+        std::vector<task_id> order( ready.begin(), ready.end() );
+        for( size_t i = 0; i < order.size(); i++ ) {
+            for( const task_id next : nodes[order[i]].dependents ) {
+                if( --check[next] == 0 ) {
+                    order.push_back( next );
+                }
+            }
+        }
+        if( static_cast<int>( order.size() ) != total ) {
+            debugmsg( "task_graph has a dependency cycle" );
+            return false;
+        }
+    }
+
+    std::mutex mutex;
+    std::condition_variable changed;
+    int finished = 0;
+    // Every worker takes ready tasks until all are finished
+    pool.run( pool.size(), [&]( int, int worker ) {
+        std::unique_lock<std::mutex> lock( mutex );
+        while( true ) {
+            changed.wait( lock, [&]() {
+                return !ready.empty() || finished == total;
+            } );
+            if( ready.empty() ) {
+                return;
+            }
+            const task_id task = ready.front();
+            ready.pop_front();
+            lock.unlock();
+            nodes[task].func( worker );
+            lock.lock();
+            finished++;
+            for( const task_id next : nodes[task].dependents ) {
+                if( --waiting_for[next] == 0 ) {
+                    ready.push_back( next );
+                }
+            }
+            changed.notify_all();
+        }
+    } );
+    return true;
+}
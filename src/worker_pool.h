@@ -0,0 +1,137 @@
+#pragma once
+#ifndef CATA_SRC_WORKER_POOL_H
+#define CATA_SRC_WORKER_POOL_H
+
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#if defined(_WIN32) && !defined(_MSC_VER)
+#   include "mingw.thread.h"
+#endif
+
+class rng_stream;
+struct point;
+
+/**
+ * A fixed set of worker threads for splitting one computation into independent parts.
+ *
+ * run() hands out the parts to the workers and the calling thread, and returns once all of
+ * them are done. Every part is told which worker runs it, so callers can give each worker its
+ * own output buffer and merge the buffers afterwards.
+ *
+ * The tasks of a run() are split into one contiguous range per worker, so neighbouring tasks
+ * (e.g. neighbouring submaps) tend to end up on the same thread. A worker that runs out of
+ * tasks steals the back half of the range of another worker.
+ */
+class worker_pool
+{
+    public:
+        /** Creates a pool with extra_threads threads besides the calling one. */
+        explicit worker_pool( int extra_threads );
+        ~worker_pool();
+
+        worker_pool( const worker_pool & ) = delete;
+        worker_pool &operator=( const worker_pool & ) = delete;
+
+        /** Number of threads working on a run(), including the caller, so at least 1. */
+        int size() const {
+            return static_cast<int>( threads.size() ) + 1;
+        }
+
+        /**
+         * Calls func( task, worker ) for every task in [0, tasks), spread over the pool, and
+         * waits until all calls returned. worker is in [0, size()), 0 being the calling thread.
+         * If the pool is already busy (e.g. run() is called from inside a task) every task is
+         * run on the calling thread as worker 0.
+         */
+        void run( int tasks, const std::function<void( int, int )> &func );
+
+        /**
+         * Like run(), but every task draws from its own random number stream, stream.fork( task ).
+         * The results don't depend on which worker runs a task or in which order, so they are the
+         * same as when the tasks are run one after another.
+         */
+        void run_seeded( int tasks, const rng_stream &stream,
+                         const std::function<void( int, int )> &func );
+
+        /**
+         * Calls func( p, worker ) for every p with 0 <= p.x < size.x and 0 <= p.y < size.y,
+         * e.g. for every submap of the map.
+         */
+        void parallel_for( const point &size,
+                           const std::function<void( const point &, int )> &func );
+
+        /**
+         * Test hook: when set, every pool runs all tasks on the calling thread, in order, as
+         * worker 0.
+         */
+        static void set_serial( bool serial );
+        static bool is_serial();
+
+    private:
+        // Remaining tasks of a worker: [begin, end)
+        struct task_range {
+            std::mutex mutex;
+            int begin = 0;
+            int end = 0;
+        };
+
+        void work( int worker );
+        void do_tasks( int worker );
+        bool next_task( int worker, int &task );
+
+        std::vector<std::thread> threads;
+        std::vector<std::unique_ptr<task_range>> ranges;
+        std::mutex mutex;
+        std::condition_variable wake_workers;
+        std::condition_variable job_done;
+
+        // Current job, guarded by mutex
+        const std::function<void( int, int )> *job = nullptr;
+        int busy_workers = 0;
+        unsigned generation = 0;
+        bool stopping = false;
+        std::atomic<bool> running{ false };
+};
+
+/** The pool shared by the game, with one thread per additional hardware core. */
+worker_pool &get_worker_pool();
+
+/**
+ * Tasks with dependencies between them, run on a worker_pool.
+ *
+ * A task only starts once every task it depends on has finished, tasks that don't depend on each
+ * other may run at the same time. This gives fork/join: tasks depending on one task fork from it,
+ * a task depending on several joins them.
+ */
+class task_graph
+{
+    public:
+        using task_id = int;
+
+        /** Adds a task, func is called with the worker running it. */
+        task_id add( const std::function<void( int )> &func );
+        /** Makes task wait for before to finish. */
+        void depends( task_id task, task_id before );
+
+        /**
+         * Runs every task and waits until all are done. If the dependencies have a cycle, nothing
+         * is run and false is returned.
+         */
+        bool run( worker_pool &pool ) const;
+
+    private:
+        struct node {
+            std::function<void( int )> func;
+            std::vector<task_id> dependents;
+            int dependencies = 0;
+        };
+        std::vector<node> nodes;
+};
+
+#endif // CATA_SRC_WORKER_POOL_H
@@ -1,4 +1,8 @@
+#include <algorithm>
+#include <climits>
 #include <iosfwd>
+#include <optional>
+#include <unordered_set>
 #include <vector>
 
 #include "activity_actor_definitions.h"
@@ -8,6 +12,7 @@
 #include "item.h"
 #include "item_category.h"
 #include "map_helpers.h"
+#include "map_iterator.h"
 #include "player_helpers.h"
 #include "pocket_type.h"
 #include "point.h"
@@ -15,6 +20,7 @@
 #include "type_id.h"
 
 static const activity_id ACT_MOVE_LOOT( "ACT_MOVE_LOOT" );
+static const faction_id faction_test_other_faction( "test_other_faction" );
 static const faction_id faction_your_followers( "your_followers" );
 
 static const itype_id itype_556( "556" );
@@ -23,11 +29,14 @@ static const itype_id itype_belt223( "belt223" );
 
 static const vproto_id vehicle_prototype_shopping_cart( "shopping_cart" );
 
+static const zone_type_id zone_type_LOOT_CUSTOM( "LOOT_CUSTOM" );
 static const zone_type_id zone_type_LOOT_DRINK( "LOOT_DRINK" );
 static const zone_type_id zone_type_LOOT_FOOD( "LOOT_FOOD" );
 static const zone_type_id zone_type_LOOT_PDRINK( "LOOT_PDRINK" );
 static const zone_type_id zone_type_LOOT_PFOOD( "LOOT_PFOOD" );
 static const zone_type_id zone_type_LOOT_UNSORTED( "LOOT_UNSORTED" );
+static const zone_type_id zone_type_NO_AUTO_PICKUP( "NO_AUTO_PICKUP" );
+static const zone_type_id zone_type_NO_NPC_PICKUP( "NO_NPC_PICKUP" );
 static const zone_type_id zone_type_UNLOAD_ALL( "UNLOAD_ALL" );
 
 namespace
@@ -60,6 +69,21 @@ void create_tile_zone( const std::string &name, const zone_type_id &zone_type, t
     zm.add( name, zone_type, faction_your_followers, false, true, pos, pos, nullptr, false, veh );
 }
 
+// Brute force reference for the zone range queries: every point within range of where
+template<typename Pred>
+std::unordered_set<tripoint_abs_ms> points_near( const tripoint_abs_ms &where, int range,
+        Pred &&pred )
+{
+    std::unordered_set<tripoint_abs_ms> ret;
+    for( const tripoint_abs_ms &p : tripoint_range<tripoint_abs_ms>(
+             where - tripoint( range, range, range ), where + tripoint( range, range, range ) ) ) {
+        if( pred( p ) ) {
+            ret.insert( p );
+        }
+    }
+    return ret;
+}
+
 } // namespace
 
 TEST_CASE( "zone_unloading_ammo_belts", "[zones][items][ammo_belt][activities][unload]" )
@@ -315,3 +339,158 @@ TEST_CASE( "zone_sorting_comestibles_", "[zones][items][food][activities]" )
         }
     }
 }
+
+TEST_CASE( "zone_range_queries_match_point_scan", "[zones]" )
+{
+    clear_map();
+    zone_manager &zm = zone_manager::get_manager();
+    zm.clear();
+
+    // Two overlapping areas and a distant single tile
+    zm.add( "Food A", zone_type_LOOT_FOOD, faction_your_followers, false, true,
+            tripoint( 2, 2, 0 ), tripoint( 6, 5, 0 ) );
+    zm.add( "Food B", zone_type_LOOT_FOOD, faction_your_followers, false, true,
+            tripoint( 5, 4, 0 ), tripoint( 9, 9, 1 ) );
+    zm.add( "Food C", zone_type_LOOT_FOOD, faction_your_followers, false, true,
+            tripoint( 40, 40, 0 ), tripoint( 40, 40, 0 ) );
+
+    const std::vector<tripoint_abs_ms> origins = {
+        tripoint_abs_ms( 0, 0, 0 ), tripoint_abs_ms( 7, 7, 0 ), tripoint_abs_ms( 12, 3, 1 ),
+        tripoint_abs_ms( 30, 30, 0 )
+    };
+    for( const tripoint_abs_ms &where : origins ) {
+        for( int range : { 0, 1, 3, 10 } ) {
+            CAPTURE( where, range );
+            const std::unordered_set<tripoint_abs_ms> expected = points_near( where, range,
+            [&zm]( const tripoint_abs_ms & p ) {
+                return zm.has( zone_type_LOOT_FOOD, p );
+            } );
+            CHECK( zm.get_near( zone_type_LOOT_FOOD, where, range ) == expected );
+            CHECK( zm.has_near( zone_type_LOOT_FOOD, where, range ) == !expected.empty() );
+            const std::optional<tripoint_abs_ms> nearest =
+                zm.get_nearest( zone_type_LOOT_FOOD, where, range );
+            REQUIRE( nearest.has_value() == !expected.empty() );
+            if( nearest ) {
+                int best = INT_MAX;
+                for( const tripoint_abs_ms &p : expected ) {
+                    best = std::min( best, square_dist( p, where ) );
+                }
+                CHECK( zm.has( zone_type_LOOT_FOOD, *nearest ) );
+                CHECK( square_dist( *nearest, where ) == best );
+            }
+        }
+    }
+}
+
+TEST_CASE( "zone_range_queries_on_vehicle_zones", "[zones][vehicle]" )
+{
+    avatar &dummy = get_avatar();
+    map &here = get_map();
+    clear_avatar();
+    clear_map();
+    zone_manager &zm = zone_manager::get_manager();
+    zm.clear();
+
+    const tripoint cart_local( 10, 10, 0 );
+    REQUIRE( here.add_vehicle( vehicle_prototype_shopping_cart, cart_local, 0_degrees, 0, 0 ) );
+    const tripoint_abs_ms cart = here.getglobal( cart_local );
+    std::optional<vpart_reference> vp = here.veh_at( cart ).cargo();
+    REQUIRE( vp );
+    vp->vehicle().set_owner( dummy );
+    create_tile_zone( "Food", zone_type_LOOT_FOOD, cart.raw(), true );
+    REQUIRE( zm.has( zone_type_LOOT_FOOD, cart ) );
+
+    const tripoint_abs_ms beside = cart + tripoint( 2, 0, 0 );
+    CHECK( zm.has_near( zone_type_LOOT_FOOD, beside, 2 ) );
+    CHECK_FALSE( zm.has_near( zone_type_LOOT_FOOD, beside, 1 ) );
+    CHECK( zm.get_near( zone_type_LOOT_FOOD, beside, 2 ) ==
+           std::unordered_set<tripoint_abs_ms> { cart } );
+    CHECK( zm.get_near( zone_type_LOOT_FOOD, beside, 1 ).empty() );
+
+    // Vehicle zones are only searched on the z-level of the origin
+    const tripoint_abs_ms above = cart + tripoint_above;
+    CHECK_FALSE( zm.has_near( zone_type_LOOT_FOOD, above, 5 ) );
+    CHECK( zm.get_near( zone_type_LOOT_FOOD, above, 5 ).empty() );
+    // ... but the nearest point is looked up in all three dimensions
+    CHECK( zm.get_nearest( zone_type_LOOT_FOOD, above, 1 ) == cart );
+}
+
+TEST_CASE( "zone_loot_point_set", "[zones][vehicle]" )
+{
+    avatar &dummy = get_avatar();
+    map &here = get_map();
+    clear_avatar();
+    clear_map();
+    zone_manager &zm = zone_manager::get_manager();
+    zm.clear();
+
+    const tripoint cart_local( 10, 10, 0 );
+    REQUIRE( here.add_vehicle( vehicle_prototype_shopping_cart, cart_local, 0_degrees, 0, 0 ) );
+    const tripoint_abs_ms cart = here.getglobal( cart_local );
+    std::optional<vpart_reference> vp = here.veh_at( cart ).cargo();
+    REQUIRE( vp );
+    vp->vehicle().set_owner( dummy );
+    create_tile_zone( "Cart food", zone_type_LOOT_FOOD, cart.raw(), true );
+    create_tile_zone( "Cart no pickup", zone_type_NO_NPC_PICKUP, cart.raw(), true );
+
+    const tripoint food_local( 12, 10, 0 );
+    const tripoint other_fac_local( 13, 10, 0 );
+    const tripoint no_pickup_local( 14, 10, 0 );
+    const tripoint far_local( 30, 10, 0 );
+    create_tile_zone( "Food", zone_type_LOOT_FOOD, here.getglobal( food_local ).raw() );
+    create_tile_zone( "Far food", zone_type_LOOT_FOOD, here.getglobal( far_local ).raw() );
+    create_tile_zone( "No pickup", zone_type_NO_AUTO_PICKUP,
+                      here.getglobal( no_pickup_local ).raw() );
+    zm.add( "Other food", zone_type_LOOT_FOOD, faction_test_other_faction, false, true,
+            here.getglobal( other_fac_local ).raw(), here.getglobal( other_fac_local ).raw() );
+
+    const tripoint_abs_ms center = here.getglobal( tripoint( 11, 10, 0 ) );
+
+    SECTION( "only loot zones of the faction in range are returned" ) {
+        CHECK( zm.get_point_set_loot( center, 5, false, faction_your_followers ) ==
+               std::unordered_set<tripoint> { cart_local, food_local } );
+        CHECK( zm.get_point_set_loot( center, 5, false, faction_test_other_faction ) ==
+               std::unordered_set<tripoint> { other_fac_local } );
+    }
+
+    SECTION( "npc searches skip vehicle tiles with NO_NPC_PICKUP" ) {
+        CHECK( zm.get_point_set_loot( center, 5, true, faction_your_followers ) ==
+               std::unordered_set<tripoint> { food_local } );
+    }
+}
+
+TEST_CASE( "zone_custom_loot_range_queries", "[zones][items]" )
+{
+    clear_map();
+    zone_manager &zm = zone_manager::get_manager();
+    zm.clear();
+
+    // Two overlapping zones with the same filter and a third one with another filter
+    mapgen_place_zone( tripoint( 0, 0, 0 ), tripoint( 3, 3, 0 ), zone_type_LOOT_CUSTOM,
+                       faction_your_followers, "Apples", "apple" );
+    mapgen_place_zone( tripoint( 2, 2, 0 ), tripoint( 5, 5, 0 ), zone_type_LOOT_CUSTOM,
+                       faction_your_followers, "More apples", "apple" );
+    mapgen_place_zone( tripoint( 4, 0, 0 ), tripoint( 6, 1, 0 ), zone_type_LOOT_CUSTOM,
+                       faction_your_followers, "Almonds", "almond" );
+
+    const item apple( "test_apple" );
+    const item almond( "test_bitter_almond" );
+    const tripoint_abs_ms where( 3, 3, 0 );
+    const int range = 3;
+
+    for( const item *it : { &apple, &almond } ) {
+        CAPTURE( it->typeId() );
+        const std::unordered_set<tripoint_abs_ms> expected = points_near( where, range,
+        [&zm, it]( const tripoint_abs_ms & p ) {
+            return zm.custom_loot_has( p, it, zone_type_LOOT_CUSTOM );
+        } );
+        REQUIRE_FALSE( expected.empty() );
+        CHECK( zm.get_near( zone_type_LOOT_CUSTOM, where, range, it ) == expected );
+    }
+    CHECK( zm.get_near( zone_type_LOOT_CUSTOM, where, range, &apple ).count(
+               tripoint_abs_ms( 6, 0, 0 ) ) == 0 );
+    CHECK( zm.get_near( zone_type_LOOT_CUSTOM, where, range, &almond ).count(
+               tripoint_abs_ms( 6, 0, 0 ) ) == 1 );
+    // Filtered zones never match without an item to check
+    CHECK( zm.get_near( zone_type_LOOT_CUSTOM, where, range ).empty() );
+}
@@ -0,0 +1,187 @@
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "avatar.h"
+#include "calendar.h"
+#include "cata_catch.h"
+#include "coordinates.h"
+#include "creature.h"
+#include "creature_visibility.h"
+#include "game.h"
+#include "map.h"
+#include "map_helpers.h"
+#include "monster.h"
+#include "player_helpers.h"
+#include "point.h"
+#include "type_id.h"
+
+static const efftype_id effect_invisibility( "invisibility" );
+
+static const move_mode_id move_mode_crouch( "crouch" );
+
+static const trait_id trait_DEBUG_CLOAK( "DEBUG_CLOAK" );
+
+static const ter_str_id ter_t_wall( "t_wall" );
+
+static std::vector<Creature *> spawn_visibility_scenario( int num_monsters )
+{
+    clear_map();
+    clear_avatar();
+    set_time_to_day();
+    map &here = get_map();
+    avatar &u = get_avatar();
+    std::vector<Creature *> creatures = { &u };
+    const point_bub_ms origin = u.pos_bub().xy();
+    // A wall east of the avatar so that some pairs can't see each other
+    for( int y = -8; y <= 8; y++ ) {
+        here.ter_set( tripoint_bub_ms( origin.x() + 4, origin.y() + y, 0 ), ter_t_wall );
+    }
+    for( int i = 0; i < num_monsters; i++ ) {
+        const tripoint_bub_ms where( origin.x() + i % 12 - 6, origin.y() + i / 12 * 3 - 7, 0 );
+        if( here.impassable( where ) || where == u.pos_bub() ) {
+            continue;
+        }
+        creatures.push_back( &spawn_test_monster( "mon_zombie", where ) );
+    }
+    here.build_map_cache( 0 );
+    return creatures;
+}
+
+static std::vector<bool> all_pairs_seen( const std::vector<Creature *> &creatures )
+{
+    std::vector<bool> seen;
+    for( const Creature *observer : creatures ) {
+        for( const Creature *target : creatures ) {
+            seen.push_back( observer->sees( *target ) );
+        }
+    }
+    return seen;
+}
+
+TEST_CASE( "visibility_cache_matches_fresh_evaluation", "[vision]" )
+{
+    const std::vector<Creature *> creatures = spawn_visibility_scenario( 30 );
+    creature_visibility_cache &cache = get_creature_visibility_cache();
+
+    creature_visibility_cache::set_enabled( false );
+    const std::vector<bool> fresh = all_pairs_seen( creatures );
+    creature_visibility_cache::set_enabled( true );
+    // Both sides of the wall are represented
+    CHECK( std::find( fresh.begin(), fresh.end(), true ) != fresh.end() );
+    CHECK( std::find( fresh.begin(), fresh.end(), false ) != fresh.end() );
+
+    cache.reset_counters();
+    CHECK( all_pairs_seen( creatures ) == fresh );
+    CHECK( cache.get_counters().hits == 0 );
+    CHECK( all_pairs_seen( creatures ) == fresh );
+    const int pairs = static_cast<int>( creatures.size() * ( creatures.size() - 1 ) );
+    CHECK( cache.get_counters().hits == pairs );
+    CHECK( cache.get_counters().misses == pairs );
+    CHECK( cache.get_counters().symmetric + cache.get_counters().fallbacks > 0 );
+
+    avatar &u = get_avatar();
+    // A monster the avatar sees, fresh[0..size) being what the avatar sees
+    const auto visible = std::find( fresh.begin() + 1, fresh.begin() + creatures.size(), true );
+    REQUIRE( visible != fresh.begin() + creatures.size() );
+    monster &zombie = *creatures[visible - fresh.begin()]->as_monster();
+
+    SECTION( "entries follow creature moves" ) {
+        const bool before = u.sees( zombie );
+        // Behind the wall, where the avatar can't see
+        const tripoint_bub_ms hidden = u.pos_bub() + tripoint( 6, 0, 0 );
+        REQUIRE( !get_map().impassable( hidden ) );
+        zombie.setpos( hidden );
+        creature_visibility_cache::set_enabled( false );
+        const bool moved_fresh = u.sees( zombie );
+        creature_visibility_cache::set_enabled( true );
+        CHECK( u.sees( zombie ) == moved_fresh );
+        CHECK( !moved_fresh );
+        CHECK( before != moved_fresh );
+    }
+
+    SECTION( "entries follow effects" ) {
+        const bool before = u.sees( zombie );
+        REQUIRE( before );
+        zombie.add_effect( effect_invisibility, 1_hours );
+        CHECK( !u.sees( zombie ) );
+        zombie.remove_effect( effect_invisibility );
+        CHECK( u.sees( zombie ) );
+    }
+
+    SECTION( "entries follow movement mode" ) {
+        const unsigned int revision = u.get_visibility_revision();
+        u.set_movement_mode( move_mode_crouch );
+        CHECK( u.get_visibility_revision() != revision );
+        for( const Creature *observer : creatures ) {
+            creature_visibility_cache::set_enabled( false );
+            const bool crouched_fresh = observer->sees( u );
+            creature_visibility_cache::set_enabled( true );
+            CHECK( observer->sees( u ) == crouched_fresh );
+        }
+    }
+
+    SECTION( "entries follow mutations" ) {
+        std::vector<bool> before;
+        for( const Creature *observer : creatures ) {
+            before.push_back( observer->sees( u ) );
+        }
+        u.set_mutation( trait_DEBUG_CLOAK );
+        bool changed = false;
+        for( size_t i = 0; i < creatures.size(); i++ ) {
+            creature_visibility_cache::set_enabled( false );
+            const bool cloaked_fresh = creatures[i]->sees( u );
+            creature_visibility_cache::set_enabled( true );
+            CHECK( creatures[i]->sees( u ) == cloaked_fresh );
+            changed |= before[i] != cloaked_fresh;
+        }
+        CHECK( changed );
+        u.unset_mutation( trait_DEBUG_CLOAK );
+    }
+
+    SECTION( "copies of a creature don't share its entries" ) {
+        monster copy = zombie;
+        CHECK( copy.get_visibility_id() != zombie.get_visibility_id() );
+        const std::uint64_t copied_id = copy.get_visibility_id();
+        copy = zombie;
+        CHECK( copy.get_visibility_id() != copied_id );
+        CHECK( copy.get_visibility_id() != zombie.get_visibility_id() );
+    }
+
+    SECTION( "removing a monster drops the cache" ) {
+        const Creature &other = *creatures[creatures.back() == &zombie ? 1 : creatures.size() - 1];
+        g->remove_zombie( zombie );
+        cache.reset_counters();
+        u.sees( other );
+        CHECK( cache.get_counters().hits == 0 );
+        CHECK( cache.get_counters().misses == 1 );
+    }
+
+    SECTION( "a new turn starts from scratch" ) {
+        calendar::turn += 1_turns;
+        cache.reset_counters();
+        all_pairs_seen( creatures );
+        CHECK( cache.get_counters().hits == 0 );
+    }
+}
+
+TEST_CASE( "visibility_queries_benchmark", "[.][vision][benchmark]" )
+{
+    const std::vector<Creature *> creatures = spawn_visibility_scenario( 60 );
+
+    BENCHMARK( "uncached" ) {
+        creature_visibility_cache::set_enabled( false );
+        const std::vector<bool> seen = all_pairs_seen( creatures );
+        creature_visibility_cache::set_enabled( true );
+        return seen.size();
+    };
+    BENCHMARK( "cached, three queries per pair" ) {
+        get_creature_visibility_cache().clear();
+        size_t seen = 0;
+        for( int i = 0; i < 3; i++ ) {
+            seen += all_pairs_seen( creatures ).size();
+        }
+        return seen;
+    };
+}
@@ -7,6 +7,7 @@
 #include "item_location.h"
 #include "game.h"
 #include "map.h"
+#include "magic_enchantment.h"
 #include "map_helpers.h"
 #include "monster.h"
 #include "npc.h"
@@ -129,6 +130,42 @@ TEST_CASE( "mutation_enchantments", "[enchantments][mutations]" )
     test_generic_ench( p, enc_test );
 }
 
+TEST_CASE( "enchantment_sources_are_only_collected_again_when_they_change",
+           "[enchantments][mutations]" )
+{
+    avatar p;
+    clear_character( p );
+    Character::enchantment_cache_counters &counters = Character::get_enchantment_cache_counters();
+
+    p.recalculate_enchantment_cache();
+    const double dex_add_before = p.enchantment_cache->get_value_add( enchant_vals::mod::DEXTERITY );
+
+    // gaining the trait recalculates the cache and collects the mutation enchantments again
+    counters = Character::enchantment_cache_counters();
+    p.toggle_trait( trait_TEST_ENCH_MUTATION );
+    REQUIRE( p.has_trait( trait_TEST_ENCH_MUTATION ) );
+    CHECK( counters.source_rebuilds >= 1 );
+    const double dex_add_with_trait = p.enchantment_cache->get_value_add(
+                                          enchant_vals::mod::DEXTERITY );
+    CHECK( dex_add_with_trait == dex_add_before + 25 );
+
+    // nothing changed, so every source is reused and the result stays the same
+    counters = Character::enchantment_cache_counters();
+    p.recalculate_enchantment_cache();
+    p.recalculate_enchantment_cache();
+    CHECK( p.enchantment_cache->get_value_add( enchant_vals::mod::DEXTERITY ) == dex_add_with_trait );
+    CHECK( counters.recalculations == 2 );
+    CHECK( counters.source_rebuilds == 0 );
+    CHECK( counters.source_reuses == 6 );
+
+    // losing the trait drops its enchantment again
+    counters = Character::enchantment_cache_counters();
+    p.toggle_trait( trait_TEST_ENCH_MUTATION );
+    REQUIRE_FALSE( p.has_trait( trait_TEST_ENCH_MUTATION ) );
+    CHECK( counters.source_rebuilds >= 1 );
+    CHECK( p.enchantment_cache->get_value_add( enchant_vals::mod::DEXTERITY ) == dex_add_before );
+}
+
 TEST_CASE( "Enchantments_change_stats", "[magic][enchantments]" )
 {
     clear_map();
@@ -0,0 +1,82 @@
+#include <chrono>
+
+#include "avatar.h"
+#include "calendar.h"
+#include "cata_catch.h"
+#include "do_turn.h"
+#include "map.h"
+#include "map_helpers.h"
+#include "monster.h"
+#include "player_activity.h"
+#include "player_helpers.h"
+#include "point.h"
+#include "type_id.h"
+
+static const activity_id ACT_WAIT( "ACT_WAIT" );
+
+static const efftype_id effect_sleep( "sleep" );
+
+static const field_type_str_id field_fd_fire( "fd_fire" );
+
+TEST_CASE( "fast_forward_only_when_nothing_is_around", "[turn][sleep]" )
+{
+    clear_map();
+    clear_avatar();
+    avatar &u = get_avatar();
+    map &here = get_map();
+
+    GIVEN( "an avatar that is awake and idle" ) {
+        CHECK_FALSE( can_fast_forward_turn() );
+    }
+
+    GIVEN( "an avatar waiting alone" ) {
+        u.assign_activity( player_activity( ACT_WAIT, to_moves<int>( 1_hours ) ) );
+        CHECK( can_fast_forward_turn() );
+    }
+
+    GIVEN( "a sleeping avatar" ) {
+        u.add_effect( effect_sleep, 8_hours );
+        CHECK( can_fast_forward_turn() );
+
+        WHEN( "a monster shows up" ) {
+            spawn_test_monster( "mon_zombie", u.pos_bub() + tripoint( 20, 0, 0 ) );
+            THEN( "turns are simulated normally" ) {
+                CHECK_FALSE( can_fast_forward_turn() );
+            }
+        }
+
+        WHEN( "a fire starts next to the avatar" ) {
+            here.add_field( u.pos_bub() + point_east, field_fd_fire );
+            THEN( "turns are simulated normally" ) {
+                CHECK_FALSE( can_fast_forward_turn() );
+            }
+        }
+    }
+}
+
+static void sleep_for_eight_hours( bool fast_forward )
+{
+    avatar &u = get_avatar();
+    const time_point end = calendar::turn + 8_hours;
+    while( calendar::turn < end ) {
+        calendar::turn += 1_turns;
+        u.update_body();
+        update_world_caches( fast_forward && can_fast_forward_turn() );
+    }
+}
+
+TEST_CASE( "fast_forward_sleep_benchmark", "[.][turn][sleep][benchmark]" )
+{
+    clear_map();
+    clear_avatar();
+    get_avatar().add_effect( effect_sleep, 24_hours );
+
+    for( const bool fast_forward : { false, true } ) {
+        const auto start = std::chrono::steady_clock::now();
+        sleep_for_eight_hours( fast_forward );
+        const auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(
+                                 std::chrono::steady_clock::now() - start );
+        WARN( ( fast_forward ? "fast-forwarded" : "per-turn" ) << " 8 hour sleep took " <<
+              elapsed.count() << " ms" );
+    }
+}
@@ -0,0 +1,156 @@
+#include <algorithm>
+#include <cstdint>
+#include <set>
+#include <sstream>
+#include <vector>
+
+#include "cata_catch.h"
+#include "flag.h"
+#include "item.h"
+#include "item_factory.h"
+#include "itype.h"
+#include "json.h"
+#include "json_loader.h"
+#include "mutation.h"
+#include "type_id.h"
+
+static const itype_id itype_rock( "rock" );
+
+static item round_trip( const item &original )
+{
+    std::ostringstream os;
+    JsonOut jsout( os );
+    jsout.write( original );
+    jsout.flush();
+    item read_back;
+    JsonValue jsin = json_loader::from_string( os.str() );
+    REQUIRE( jsin.read( read_back ) );
+    return read_back;
+}
+
+// Whether the item has the flag according to the flag sets alone
+static bool has_flag_in_sets( const item &it, const flag_id &f )
+{
+    return it.type->get_flags().count( f ) || it.get_flags().count( f );
+}
+
+static void check_item_flags( const item &it )
+{
+    for( const json_flag &f : json_flag::get_all() ) {
+        if( it.has_flag( f.id ) != has_flag_in_sets( it, f.id ) ) {
+            CAPTURE( it.typeId().str(), f.id.str() );
+            CHECK( it.has_flag( f.id ) == has_flag_in_sets( it, f.id ) );
+        }
+    }
+}
+
+TEST_CASE( "flag_bits_match_flag_sets", "[flag]" )
+{
+    SECTION( "item types" ) {
+        int checked = 0;
+        for( const itype *type : item_controller->all() ) {
+            if( type->get_flags().empty() || checked++ > 200 ) {
+                continue;
+            }
+            for( const json_flag &f : json_flag::get_all() ) {
+                if( type->has_flag( f.id ) != ( type->get_flags().count( f.id ) > 0 ) ) {
+                    CAPTURE( type->get_id().str(), f.id.str() );
+                    CHECK( type->has_flag( f.id ) == ( type->get_flags().count( f.id ) > 0 ) );
+                }
+            }
+        }
+        CHECK( checked > 0 );
+    }
+
+    SECTION( "bits" ) {
+        const std::set<flag_id> flags = { flag_FILTHY, flag_FIT };
+        flag_bitset bits;
+        CHECK_FALSE( bits.is_complete() );
+        bits.assign( flags );
+        CHECK( bits.is_complete() );
+        CHECK( bits.test( flag_FILTHY ) );
+        CHECK( bits.test( flag_FIT ) );
+        CHECK( bits.test( flag_bitset::bit_of( flag_FIT ) ) );
+        CHECK_FALSE( bits.test( flag_WATERPROOF ) );
+        // Only the words up to the highest bit are kept
+        const int highest = std::max( flag_bitset::bit_of( flag_FILTHY ).to_i(),
+                                      flag_bitset::bit_of( flag_FIT ).to_i() );
+        CHECK( bits.memory_usage() <= ( highest / 64 + 1 ) * sizeof( std::uint64_t ) );
+
+        const flag_id not_loaded( "NOT_A_LOADED_FLAG" );
+        CHECK( flag_bitset::bit_of( not_loaded ).to_i() < 0 );
+        CHECK_FALSE( bits.test( not_loaded ) );
+        bits.add( not_loaded );
+        CHECK_FALSE( bits.is_complete() );
+    }
+
+    SECTION( "mutations" ) {
+        for( const mutation_branch &mut : mutation_branch::get_all() ) {
+            REQUIRE( mut.flag_bits.is_complete() );
+            for( const json_character_flag &f : mut.flags ) {
+                CHECK( mut.flag_bits.test( f ) );
+            }
+        }
+    }
+
+    SECTION( "setting and unsetting item flags" ) {
+        item rock( itype_rock );
+        check_item_flags( rock );
+        CHECK_FALSE( rock.has_flag( flag_FILTHY ) );
+
+        rock.set_flag( flag_FILTHY );
+        rock.set_flag( flag_FIT );
+        CHECK( rock.has_flag( flag_FILTHY ) );
+        CHECK( rock.has_flag( flag_FIT ) );
+        check_item_flags( rock );
+
+        const item copy = rock;
+        CHECK( copy.has_flag( flag_FILTHY ) );
+
+        const item loaded = round_trip( rock );
+        CHECK( loaded.has_flag( flag_FILTHY ) );
+        CHECK( loaded.has_flag( flag_FIT ) );
+        check_item_flags( loaded );
+
+        rock.unset_flag( flag_FILTHY );
+        CHECK_FALSE( rock.has_flag( flag_FILTHY ) );
+        CHECK( rock.has_flag( flag_FIT ) );
+        check_item_flags( rock );
+
+        rock.unset_flags();
+        CHECK_FALSE( rock.has_flag( flag_FIT ) );
+        check_item_flags( rock );
+    }
+}
+
+TEST_CASE( "flag_bitset_benchmark", "[.][flag][benchmark]" )
+{
+    std::vector<item> items;
+    for( const itype *type : item_controller->all() ) {
+        if( items.size() < 1000 ) {
+            items.emplace_back( type );
+        }
+    }
+    const std::vector<flag_id> flags = {
+        flag_FIT, flag_FILTHY, flag_WATERPROOF, flag_OVERSIZE, flag_NO_UNLOAD, flag_FRAGILE
+    };
+
+    BENCHMARK( "item::has_flag" ) {
+        int found = 0;
+        for( const item &it : items ) {
+            for( const flag_id &f : flags ) {
+                found += it.has_flag( f );
+            }
+        }
+        return found;
+    };
+    BENCHMARK( "flag sets" ) {
+        int found = 0;
+        for( const item &it : items ) {
+            for( const flag_id &f : flags ) {
+                found += has_flag_in_sets( it, f );
+            }
+        }
+        return found;
+    };
+}
@@ -0,0 +1,147 @@
+#include <algorithm>
+#include <map>
+#include <set>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "cata_catch.h"
+#include "flat_id_map.h"
+#include "flat_set.h"
+#include "json.h"
+#include "json_loader.h"
+#include "type_id.h"
+
+static std::vector<json_character_flag> some_flags( int count )
+{
+    std::vector<json_character_flag> ret;
+    for( int i = 0; i < count; i++ ) {
+        ret.emplace_back( "TEST_FLAG_" + std::to_string( ( i * 7 ) % count ) );
+    }
+    return ret;
+}
+
+TEST_CASE( "flat_id_set_matches_std_set", "[flat_id_map]" )
+{
+    const std::vector<json_character_flag> flags = some_flags( 20 );
+    std::set<json_character_flag> ref;
+    cata::flat_id_set<json_character_flag> s;
+    for( size_t i = 0; i < flags.size(); i += 2 ) {
+        CHECK( s.insert( flags[i] ).second == ref.insert( flags[i] ).second );
+    }
+    CHECK_FALSE( s.insert( flags[0] ).second );
+    REQUIRE( s.size() == ref.size() );
+    // Same order as std::set, both go by the interned index
+    CHECK( std::equal( s.begin(), s.end(), ref.begin() ) );
+    for( const json_character_flag &f : flags ) {
+        CAPTURE( f.str() );
+        CHECK( s.count( f ) == ref.count( f ) );
+        CHECK( ( s.find( f ) != s.end() ) == ( ref.count( f ) == 1 ) );
+    }
+
+    CHECK( s.erase( flags[0] ) == 1 );
+    CHECK( s.erase( flags[1] ) == 0 );
+    CHECK( s.count( flags[0] ) == 0 );
+    s.erase( s.find( flags[2] ) );
+    CHECK( s.count( flags[2] ) == 0 );
+    CHECK( s.size() == ref.size() - 2 );
+
+    const cata::flat_id_set<json_character_flag> copy( ref.begin(), ref.end() );
+    CHECK( copy != s );
+    s.insert( flags[0] );
+    s.insert( flags[2] );
+    CHECK( copy == s );
+}
+
+TEST_CASE( "flat_id_map_matches_std_map", "[flat_id_map]" )
+{
+    const std::vector<json_character_flag> flags = some_flags( 20 );
+    std::map<json_character_flag, int> ref;
+    cata::flat_id_map<json_character_flag, int> m;
+    for( size_t i = 0; i < flags.size(); i += 2 ) {
+        m[flags[i]] = static_cast<int>( i );
+        ref[flags[i]] = static_cast<int>( i );
+    }
+    CHECK_FALSE( m.emplace( flags[0], 100 ).second );
+    CHECK( m[flags[0]] == 0 );
+    CHECK( m.emplace( flags[1], 1 ).second );
+    ref.emplace( flags[1], 1 );
+
+    REQUIRE( m.size() == ref.size() );
+    CHECK( std::equal( m.begin(), m.end(), ref.begin(), []( const auto & l, const auto & r ) {
+        return l.first == r.first && l.second == r.second;
+    } ) );
+    for( const json_character_flag &f : flags ) {
+        CAPTURE( f.str() );
+        REQUIRE( m.count( f ) == ref.count( f ) );
+        if( ref.count( f ) ) {
+            CHECK( m.find( f )->second == ref[f] );
+        }
+    }
+
+    CHECK( m.erase( flags[1] ) == 1 );
+    CHECK( m.erase( flags[1] ) == 0 );
+    m.erase( m.find( flags[0] ) );
+    CHECK( m.count( flags[0] ) == 0 );
+    CHECK( m.size() == ref.size() - 2 );
+    m.clear();
+    CHECK( m.empty() );
+}
+
+TEST_CASE( "flat_id_containers_json_round_trip", "[flat_id_map][json]" )
+{
+    const std::vector<json_character_flag> flags = some_flags( 5 );
+    const cata::flat_id_set<json_character_flag> s( flags.begin(), flags.end() );
+    cata::flat_id_map<json_character_flag, int> m;
+    m[flags[3]] = 3;
+    m[flags[1]] = 1;
+
+    std::ostringstream os;
+    JsonOut jsout( os );
+    jsout.start_object();
+    jsout.member( "set", s );
+    jsout.member( "map", m );
+    jsout.end_object();
+
+    JsonObject jo = json_loader::from_string( os.str() ).get_object();
+    cata::flat_id_set<json_character_flag> s_read;
+    cata::flat_id_map<json_character_flag, int> m_read;
+    REQUIRE( jo.read( "set", s_read ) );
+    REQUIRE( jo.read( "map", m_read ) );
+    CHECK( s_read == s );
+    REQUIRE( m_read.size() == 2 );
+    CHECK( m_read[flags[3]] == 3 );
+    CHECK( m_read[flags[1]] == 1 );
+}
+
+TEST_CASE( "flag_lookup_benchmark", "[.][flat_id_map][benchmark]" )
+{
+    // About as many flags as a mutation or an item type has, looked up with as many misses
+    const std::vector<json_character_flag> flags = some_flags( 40 );
+    const std::vector<json_character_flag> present( flags.begin(), flags.begin() + 20 );
+    const std::set<json_character_flag> tree( present.begin(), present.end() );
+    const cata::flat_set<json_character_flag> flat( present.begin(), present.end() );
+    const cata::flat_id_set<json_character_flag> flat_id( present.begin(), present.end() );
+
+    BENCHMARK( "std::set" ) {
+        int found = 0;
+        for( const json_character_flag &f : flags ) {
+            found += tree.count( f );
+        }
+        return found;
+    };
+    BENCHMARK( "cata::flat_set" ) {
+        int found = 0;
+        for( const json_character_flag &f : flags ) {
+            found += flat.count( f );
+        }
+        return found;
+    };
+    BENCHMARK( "cata::flat_id_set" ) {
+        int found = 0;
+        for( const json_character_flag &f : flags ) {
+            found += flat_id.count( f );
+        }
+        return found;
+    };
+}
@@ -0,0 +1,117 @@
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "avatar.h"
+#include "calendar.h"
+#include "cata_catch.h"
+#include "item.h"
+#include "item_memory_census.h"
+#include "json.h"
+#include "json_loader.h"
+#include "map.h"
+#include "map_helpers.h"
+#include "player_helpers.h"
+#include "type_id.h"
+
+static const itype_id itype_backpack( "backpack" );
+static const itype_id itype_radio( "radio" );
+static const itype_id itype_rock( "rock" );
+
+static const matec_id WBLOCK_1( "WBLOCK_1" );
+
+static const mtype_id mon_zombie( "mon_zombie" );
+
+static item round_trip( const item &original )
+{
+    std::ostringstream os;
+    JsonOut jsout( os );
+    jsout.write( original );
+    jsout.flush();
+    item read_back;
+    JsonValue jsin = json_loader::from_string( os.str() );
+    REQUIRE( jsin.read( read_back ) );
+    return read_back;
+}
+
+TEST_CASE( "rarely_used_item_members_are_allocated_when_set", "[item][memory]" )
+{
+    item radio( itype_radio );
+    const size_t plain_bytes = radio.memory_usage();
+
+    radio.set_frequency( 0 );
+    CHECK( radio.memory_usage() == plain_bytes );
+    CHECK( round_trip( radio ).memory_usage() == plain_bytes );
+
+    radio.set_frequency( 7 );
+    CHECK( radio.get_frequency() == 7 );
+    CHECK( radio.memory_usage() > plain_bytes );
+
+    radio.add_technique( WBLOCK_1 );
+    CHECK( radio.has_technique( WBLOCK_1 ) );
+    CHECK( item( itype_radio ).get_frequency() == 0 );
+    CHECK_FALSE( item( itype_radio ).has_technique( WBLOCK_1 ) );
+
+    const item copy = radio;
+    CHECK( copy.get_frequency() == 7 );
+    CHECK( copy.has_technique( WBLOCK_1 ) );
+
+    const item loaded = round_trip( radio );
+    CHECK( loaded.get_frequency() == 7 );
+    CHECK( loaded.has_technique( WBLOCK_1 ) );
+
+    const item corpse = item::make_corpse( mon_zombie, calendar::turn, "Alex" );
+    CHECK( corpse.get_corpse_name() == "Alex" );
+    CHECK( round_trip( corpse ).get_corpse_name() == "Alex" );
+    CHECK( item::make_corpse( mon_zombie ).get_corpse_name().empty() );
+    CHECK( item( itype_rock ).get_corpse_name().empty() );
+}
+
+TEST_CASE( "item_memory_census_counts_map_and_character_items", "[item][memory]" )
+{
+    clear_map();
+    clear_avatar();
+    map &here = get_map();
+    avatar &u = get_avatar();
+    const item_memory_census before = item_memory_census::take();
+
+    const tripoint_bub_ms spot = u.pos_bub() + tripoint_east;
+    for( int i = 0; i < 3; i++ ) {
+        here.add_item( spot, item( itype_rock ) );
+    }
+    item backpack( itype_backpack );
+    REQUIRE( backpack.put_in( item( itype_rock ), pocket_type::CONTAINER ).success() );
+    here.add_item( spot, backpack );
+    u.set_wielded_item( item( itype_rock ) );
+
+    const item_memory_census after = item_memory_census::take();
+    const auto count_of = []( const item_memory_census & census, const itype_id & type ) {
+        const auto iter = census.get_by_type().find( type );
+        return iter == census.get_by_type().end() ? 0 : iter->second.count;
+    };
+    const auto place_count = []( const item_memory_census & census, const std::string & place ) {
+        const auto iter = census.get_by_place().find( place );
+        return iter == census.get_by_place().end() ? 0 : iter->second.count;
+    };
+    CHECK( count_of( after, itype_rock ) - count_of( before, itype_rock ) == 5 );
+    CHECK( count_of( after, itype_backpack ) - count_of( before, itype_backpack ) == 1 );
+    CHECK( place_count( after, "map" ) - place_count( before, "map" ) == 5 );
+    CHECK( place_count( after, "characters" ) - place_count( before, "characters" ) == 1 );
+
+    size_t place_bytes = 0;
+    for( const auto &place : after.get_by_place() ) {
+        place_bytes += place.second.bytes;
+    }
+    CHECK( place_bytes == after.get_total().bytes );
+    CHECK( after.report( 5 ).find( "rock" ) != std::string::npos );
+}
+
+TEST_CASE( "item_copy_benchmark", "[.][item][memory][benchmark]" )
+{
+    const std::vector<item> rocks( 10000, item( itype_rock ) );
+
+    BENCHMARK( "copy 10000 items" ) {
+        const std::vector<item> copies = rocks;
+        return copies.size();
+    };
+}
@@ -0,0 +1,103 @@
+#include <cstddef>
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "advanced_inv_pane.h"
+#include "cata_catch.h"
+#include "flag.h"
+#include "item.h"
+#include "item_search.h"
+#include "type_id.h"
+
+static const itype_id itype_backpack_hiking( "backpack_hiking" );
+static const itype_id itype_hammer( "hammer" );
+static const itype_id itype_jeans( "jeans" );
+static const itype_id itype_katana( "katana" );
+static const itype_id itype_rock( "rock" );
+static const itype_id itype_sheet_cotton( "sheet_cotton" );
+
+static std::vector<item> items_to_search( int count )
+{
+    const std::vector<itype_id> kinds = { itype_backpack_hiking, itype_hammer, itype_jeans,
+                                          itype_katana, itype_rock, itype_sheet_cotton
+                                        };
+    std::vector<item> items;
+    items.reserve( count );
+    for( int i = 0; i < count; i++ ) {
+        item it( kinds[i % kinds.size()] );
+        if( i % 5 == 0 ) {
+            it.set_flag( flag_FILTHY );
+        }
+        items.push_back( it );
+    }
+    return items;
+}
+
+TEST_CASE( "filters_narrow_only_when_extending_a_substring_search", "[item][search]" )
+{
+    CHECK( filter_only_narrows( "", "rock" ) );
+    CHECK( filter_only_narrows( "ro", "rock" ) );
+    CHECK( filter_only_narrows( "c:to", "c:tools" ) );
+    CHECK( filter_only_narrows( "m:", "m:steel" ) );
+    CHECK( filter_only_narrows( "rock", "rock" ) );
+
+    CHECK_FALSE( filter_only_narrows( "rock", "ro" ) );
+    CHECK_FALSE( filter_only_narrows( "rock", "hammer" ) );
+    CHECK_FALSE( filter_only_narrows( "rock", "rock,hammer" ) );
+    CHECK_FALSE( filter_only_narrows( "rock", "rock-" ) );
+    CHECK_FALSE( filter_only_narrows( "-ro", "-rock" ) );
+    CHECK_FALSE( filter_only_narrows( "c", "c:tools" ) );
+    CHECK_FALSE( filter_only_narrows( "f:FILT", "f:FILTHY" ) );
+    CHECK_FALSE( filter_only_narrows( "b:ro", "b:rock;c" ) );
+}
+
+TEST_CASE( "typed_filters_match_freshly_built_filters", "[item][search]" )
+{
+    const std::vector<item> items = items_to_search( 60 );
+    // Typing, deleting and retyping, with prefixes, alternatives and exclusions
+    const std::vector<std::string> typed = {
+        "j", "je", "jea", "j", "", "r", "ro", "roc", "rock", "rock,", "rock,h", "rock,ha",
+        "-", "-r", "-ro", "c", "c:", "c:t", "c:to", "c:c", "m:", "m:s", "m:st", "f:", "f:FILTHY",
+        "f:FILTH", "h", "ha", "ham"
+    };
+    advanced_inventory_pane pane;
+    for( const std::string &filter : typed ) {
+        CAPTURE( filter );
+        pane.set_filter( filter );
+        pane.start_listing();
+        const std::function<bool( const item & )> fresh = item_filter_from_string( filter );
+        for( const item &it : items ) {
+            CHECK( pane.is_filtered( it ) == !fresh( it ) );
+        }
+    }
+}
+
+TEST_CASE( "typing_a_filter_benchmark", "[.][item][search][benchmark]" )
+{
+    const std::vector<item> items = items_to_search( 5000 );
+    const std::vector<std::string> typed = { "s", "sh", "she", "shee", "sheet" };
+
+    BENCHMARK( "fresh filter on every keystroke" ) {
+        size_t shown = 0;
+        for( const std::string &filter : typed ) {
+            const std::function<bool( const item & )> fresh = item_filter_from_string( filter );
+            for( const item &it : items ) {
+                shown += fresh( it ) ? 1 : 0;
+            }
+        }
+        return shown;
+    };
+    BENCHMARK( "narrowing the previous results" ) {
+        advanced_inventory_pane pane;
+        size_t shown = 0;
+        for( const std::string &filter : typed ) {
+            pane.set_filter( filter );
+            pane.start_listing();
+            for( const item &it : items ) {
+                shown += pane.is_filtered( it ) ? 0 : 1;
+            }
+        }
+        return shown;
+    };
+}
@@ -13,6 +13,7 @@
 #include "enums.h"
 #include "flag.h"
 #include "game.h"
+#include "inventory.h"
 #include "item_category.h"
 #include "item_factory.h"
 #include "itype.h"
@@ -197,6 +198,92 @@ TEST_CASE( "stacking_over_time", "[item]" )
     }
 }
 
+static std::vector<item> items_for_stacking()
+{
+    std::vector<item> result;
+    for( const itype_id &type : {
+             itype_test_backpack, itype_test_mp3, itype_id( "rock" ), itype_id( "neccowafers" )
+         } ) {
+        for( int damage : {
+                 0, 1000, 1001, 3000
+             } ) {
+            for( bool favorite : {
+                     false, true
+                 } ) {
+                item it( type );
+                it.set_damage( damage );
+                it.set_favorite( favorite );
+                result.push_back( it );
+                it.burnt = 1;
+                result.push_back( it );
+            }
+        }
+    }
+    return result;
+}
+
+TEST_CASE( "items_that_stack_have_the_same_fingerprint", "[item][stack]" )
+{
+    const std::vector<item> items = items_for_stacking();
+    int stacking_pairs = 0;
+    for( const item &a : items ) {
+        for( const item &b : items ) {
+            for( int flags = 0; flags < 16; flags++ ) {
+                const bool stacks = a.stacks_with( b, flags & 1, flags & 2, flags & 4, 0, 2, flags & 8 );
+                if( stacks ) {
+                    stacking_pairs++;
+                    CAPTURE( a.tname(), b.tname(), flags );
+                    CHECK( a.stacking_fingerprint() == b.stacking_fingerprint() );
+                }
+            }
+        }
+    }
+    // Make sure the test covers stacking items at all
+    CHECK( stacking_pairs > 0 );
+}
+
+TEST_CASE( "inventory_stacks_by_fingerprint_like_before", "[item][stack][inventory]" )
+{
+    inventory inv;
+    for( int i = 0; i < 3; i++ ) {
+        for( const item &it : items_for_stacking() ) {
+            inv.add_item( it );
+        }
+    }
+    // Every item stacks with its copies and nothing else, except items counted by charges,
+    // which merge into one
+    const std::vector<item> items = items_for_stacking();
+    size_t expected_stacks = 0;
+    for( size_t i = 0; i < items.size(); i++ ) {
+        bool stacks_with_earlier = false;
+        for( size_t j = 0; j < i; j++ ) {
+            stacks_with_earlier |= static_cast<bool>( items[j].stacks_with( items[i] ) );
+        }
+        if( !stacks_with_earlier ) {
+            expected_stacks++;
+        }
+    }
+    CHECK( inv.size() == expected_stacks );
+}
+
+TEST_CASE( "inventory_restack_benchmark", "[.][item][stack][benchmark]" )
+{
+    std::vector<item> items;
+    for( int i = 0; i < 100; i++ ) {
+        for( const item &it : items_for_stacking() ) {
+            items.push_back( it );
+        }
+    }
+    BENCHMARK( "restack 6400 unstacked items" ) {
+        inventory inv;
+        for( const item &it : items ) {
+            inv.add_item( it, false, false, false );
+        }
+        inv.restack( get_avatar() );
+        return inv.size();
+    };
+}
+
 TEST_CASE( "liquids_at_different_temperatures", "[item][temperature][stack][combine]" )
 {
     item liquid_hot( "test_liquid" );
@@ -1,5 +1,8 @@
+#include <functional>
 #include <memory>
 #include <string>
+#include <utility>
+#include <vector>
 
 #include "avatar.h"
 #include "calendar.h"
@@ -10,9 +13,11 @@
 #include "item.h"
 #include "item_category.h"
 #include "item_pocket.h"
+#include "item_search.h"
 #include "item_tname.h"
 #include "itype.h"
 #include "options_helpers.h"
+#include "output.h"
 #include "pocket_type.h"
 #include "ret_val.h"
 #include "type_id.h"
@@ -947,3 +952,112 @@ TEST_CASE( "nested_items_tname", "[item][tname]" )
         }
     }
 }
+
+TEST_CASE( "tname_follows_item_changes", "[item][tname]" )
+{
+    const std::vector<std::pair<std::string, std::function<void( item & )>>> changes = {
+        { "note", []( item & it ) { it.set_var( "item_note", "mine" ); } },
+        { "wet", []( item & it ) { it.set_flag( flag_WET ); } },
+        { "filthy", []( item & it ) { it.set_flag( flag_FILTHY ); } },
+        { "unfit", []( item & it ) { it.unset_flag( flag_FIT ); } },
+        { "damaged", []( item & it ) { it.set_damage( it.max_damage() ); } },
+        { "favorite", []( item & it ) { it.set_favorite( true ); } },
+        { "fault", []( item & it ) { it.set_fault( fault_gun_dirt ); } },
+    };
+    for( const std::pair<std::string, std::function<void( item & )>> &change : changes ) {
+        CAPTURE( change.first );
+        // cached is named before the change, fresh is only named after it
+        item cached( "jeans" );
+        cached.set_flag( flag_FIT );
+        const std::string before = cached.tname();
+        REQUIRE( cached.tname() == before );
+        change.second( cached );
+
+        item fresh( "jeans" );
+        fresh.set_flag( flag_FIT );
+        change.second( fresh );
+        CHECK( cached.tname() == fresh.tname() );
+        CHECK( cached.tname( 2 ) == fresh.tname( 2 ) );
+        CHECK( cached.tname( 1, false ) == fresh.tname( 1, false ) );
+    }
+
+    SECTION( "contents" ) {
+        item bag( itype_bag_plastic );
+        const std::string empty_name = bag.tname();
+        REQUIRE( bag.put_in( item( itype_rock ), pocket_type::CONTAINER ).success() );
+        CHECK( bag.tname() != empty_name );
+        bag.clear_items();
+        CHECK( bag.tname() == empty_name );
+    }
+
+    SECTION( "next turn" ) {
+        item apple( "apple" );
+        apple.set_relative_rot( 0.1 );
+        const std::string fresh_name = apple.tname();
+        apple.set_relative_rot( 1.5 );
+        calendar::turn += 1_turns;
+        CHECK( apple.tname() != fresh_name );
+    }
+}
+
+TEST_CASE( "tname_cache_scope", "[item][tname]" )
+{
+    item jeans( "jeans" );
+    item filthy_jeans( "jeans" );
+    filthy_jeans.set_flag( flag_FILTHY );
+    const std::string fresh_name = jeans.tname();
+    REQUIRE( filthy_jeans.tname() != fresh_name );
+    {
+        tname::cache_scope names;
+        REQUIRE( jeans.tname() == fresh_name );
+        {
+            tname::cache_scope nested;
+            jeans.set_flag( flag_FILTHY );
+            // Items must not change within a scope, the name from before is kept
+            CHECK( jeans.tname() == fresh_name );
+            // Other quantities or segments are named anew
+            CHECK( jeans.tname( 2 ) == filthy_jeans.tname( 2 ) );
+        }
+        // Nested scopes share the names of the outermost one
+        CHECK( jeans.tname() == fresh_name );
+    }
+    CHECK( jeans.tname() == filthy_jeans.tname() );
+}
+
+TEST_CASE( "inventory_names_with_many_items_benchmark", "[.][item][tname][benchmark]" )
+{
+    const std::vector<itype_id> kinds = { itype_rock, itype_hammer, itype_purse, itype_bag_plastic,
+                                          itype_id( "jeans" ), itype_id( "sheet_cotton" ), itype_id( "katana" )
+                                        };
+    std::vector<item> items;
+    for( int i = 0; i < 5000; i++ ) {
+        item it( kinds[i % kinds.size()] );
+        it.set_damage( static_cast<int>( i / kinds.size() % 3 ) * itype::damage_scale );
+        if( i % 7 == 0 ) {
+            it.set_flag( flag_FILTHY );
+        }
+        items.push_back( it );
+    }
+    // Like preparing an inventory layout: filter, measure the columns twice and draw
+    const auto lay_out = [&items]() {
+        size_t total = 0;
+        const std::function<bool( const item & )> filter_func = item_filter_from_string( "jean" );
+        for( const item &it : items ) {
+            total += filter_func( it ) ? 1 : 0;
+        }
+        for( int pass = 0; pass < 3; pass++ ) {
+            for( const item &it : items ) {
+                total += remove_color_tags( it.tname() ).size();
+            }
+        }
+        return total;
+    };
+
+    BENCHMARK( "lay out 5000 items" ) {
+        return lay_out();
+    };
+    BENCHMARK( "lay out 5000 items in a cache scope" ) {
+        tname::cache_scope names;
+        return lay_out();
+    };
+}
@@ -1,5 +1,6 @@
 #include <algorithm>
 #include <array>
+#include <cstddef>
 #include <functional>
 #include <iterator>
 #include <list>
@@ -11,6 +12,7 @@
 #include <utility>
 #include <vector>
 
+#include "avatar.h"
 #include "bodypart.h"
 #include "cached_options.h"
 #include "cata_scope_helpers.h"
@@ -36,6 +38,7 @@ static const field_type_str_id field_test_field( "test_field" );
 
 static const flag_id json_flag_DIRTY( "DIRTY" );
 
+static const itype_id itype_backpack_hiking( "backpack_hiking" );
 static const itype_id itype_test_rag( "test_rag" );
 
 static const mtype_id foo( "foo" );
@@ -947,3 +950,141 @@ TEST_CASE( "serialize_optional", "[json]" )
         test_serialization( v, "[1,2,3]" );
     }
 }
+
+// Escapes the way JsonOut always did, one character at a time
+static std::string reference_json_string( const std::string &val )
+{
+    std::string escaped = "\"";
+    for( const char c : val ) {
+        const unsigned char ch = c;
+        if( ch == '"' ) {
+            escaped += "\\\"";
+        } else if( ch == '\\' ) {
+            escaped += "\\\\";
+        } else if( ch == '\b' ) {
+            escaped += "\\b";
+        } else if( ch == '\f' ) {
+            escaped += "\\f";
+        } else if( ch == '\n' ) {
+            escaped += "\\n";
+        } else if( ch == '\r' ) {
+            escaped += "\\r";
+        } else if( ch == '\t' ) {
+            escaped += "\\t";
+        } else if( ch < 0x20 ) {
+            escaped += string_format( "\\u%04X", ch );
+        } else {
+            escaped += c;
+        }
+    }
+    return escaped + "\"";
+}
+
+TEST_CASE( "jsonout_escapes_strings", "[json]" )
+{
+    const std::vector<std::string> specials = {
+        "\"", "\\", "/", "\b", "\f", "\n", "\r", "\t", "\x01", "\x02", "\x1f",
+        "\x7f", "\u00e9", "\u65e5\u672c"
+    };
+    for( const std::string &special : specials ) {
+        // In every position relative to the eight byte words skipped at once
+        for( size_t before = 0; before < 18; before++ ) {
+            const std::string val = std::string( before, 'a' ) + special + "tail of the string";
+            CAPTURE( val );
+            std::ostringstream os;
+            JsonOut jsout( os );
+            jsout.write( val );
+            CHECK( os.str() == reference_json_string( val ) );
+            JsonValue jsin = json_loader::from_string( os.str() );
+            CHECK( jsin.get_string() == val );
+        }
+    }
+}
+
+static void write_nested_values( JsonOut &jsout )
+{
+    jsout.start_array();
+    for( int i = 0; i < 100; i++ ) {
+        jsout.start_object();
+        jsout.member( "index", i );
+        jsout.member( "half", i / 2.0 );
+        jsout.member( "odd", i % 2 == 1 );
+        jsout.member( "name", string_format( "entry \"%d\"\n", i ) );
+        jsout.member( "list", std::vector<int64_t> { -i, i * 1000000000LL } );
+        jsout.member( "nothing" );
+        jsout.write_null();
+        jsout.end_object();
+    }
+    jsout.end_array();
+}
+
+TEST_CASE( "jsonout_buffering_does_not_change_output", "[json]" )
+{
+    const bool pretty = GENERATE( false, true );
+    CAPTURE( pretty );
+    std::ostringstream buffered;
+    {
+        JsonOut jsout( buffered, pretty );
+        write_nested_values( jsout );
+    }
+    std::ostringstream unbuffered;
+    {
+        JsonOut::set_buffering_enabled( false );
+        on_out_of_scope restore_buffering( []() {
+            JsonOut::set_buffering_enabled( true );
+        } );
+        JsonOut jsout( unbuffered, pretty );
+        write_nested_values( jsout );
+    }
+    CHECK( buffered.str() == unbuffered.str() );
+    CHECK( buffered.str().find( "\"half\":1.500000" ) != std::string::npos );
+    CHECK( buffered.str().find( "\"odd\":true" ) != std::string::npos );
+    CHECK( buffered.str().find( "-99" ) != std::string::npos );
+}
+
+TEST_CASE( "jsonout_stream_is_up_to_date_between_values", "[json]" )
+{
+    std::ostringstream os;
+    JsonOut jsout( os );
+    jsout.start_object();
+    jsout.member( "a", 1 );
+    // Still buffered while the object is open
+    CHECK( os.str().empty() );
+    jsout.write_raw( "\n" );
+    jsout.member( "b" );
+    *jsout.get_stream() << "[]";
+    CHECK( os.str() == "{\"a\":1\n,\"b\":[]" );
+    jsout.set_need_separator();
+    jsout.end_object();
+    CHECK( os.str() == "{\"a\":1\n,\"b\":[]}" );
+}
+
+TEST_CASE( "jsonout_benchmark", "[.][json][benchmark]" )
+{
+    std::vector<item> items;
+    for( int i = 0; i < 200; i++ ) {
+        items.emplace_back( i % 2 == 0 ? itype_test_rag : itype_backpack_hiking );
+    }
+    const avatar &u = get_avatar();
+
+    for( const bool buffering : {
+             false, true
+         } ) {
+        JsonOut::set_buffering_enabled( buffering );
+        BENCHMARK( buffering ? "items, buffered" : "items, unbuffered" ) {
+            std::ostringstream os;
+            JsonOut jsout( os );
+            jsout.write( items );
+            jsout.flush();
+            return os.str().size();
+        };
+        BENCHMARK( buffering ? "avatar, buffered" : "avatar, unbuffered" ) {
+            std::ostringstream os;
+            JsonOut jsout( os );
+            u.serialize( jsout );
+            jsout.flush();
+            return os.str().size();
+        };
+    }
+    JsonOut::set_buffering_enabled( true );
+}
@@ -1,21 +1,39 @@
 #include "cata_catch.h"
 #include "map.h"
 
+#include <algorithm>
+#include <chrono>
 #include <memory>
+#include <ostream>
+#include <string>
+#include <utility>
 #include <vector>
 
 #include "avatar.h"
+#include "cached_options.h"
+#include "cata_utility.h"
 #include "coordinate_constants.h"
 #include "coordinates.h"
+#include "debug.h"
 #include "enums.h"
+#include "filesystem.h"
 #include "itype.h"
 #include "game.h"
 #include "game_constants.h"
+#include "item.h"
+#include "item_location.h"
 #include "map_helpers.h"
+#include "mapbuffer.h"
+#include "overmapbuffer.h"
+#include "path_info.h"
 #include "point.h"
+#include "rng.h"
+#include "string_formatter.h"
 #include "submap.h"
 #include "type_id.h"
 
+static const ter_str_id ter_t_wall( "t_wall" );
+
 TEST_CASE( "map_coordinate_conversion_functions" )
 {
     map &here = get_map();
@@ -312,3 +330,247 @@ TEST_CASE( "active_monster_drops", "[active_item][map]" )
     }
     CHECK( dropped_bag.empty() );
 }
+
+static std::vector<tripoint_bub_ms> scan_tiles_with_items( const map &here,
+        const tripoint_bub_ms &center, int range )
+{
+    std::vector<tripoint_bub_ms> ret;
+    for( int x = center.x() - range; x <= center.x() + range; x++ ) {
+        for( int y = center.y() - range; y <= center.y() + range; y++ ) {
+            const tripoint_bub_ms p( x, y, center.z() );
+            if( here.inbounds( p ) && here.has_items( p ) ) {
+                ret.push_back( p );
+            }
+        }
+    }
+    return ret;
+}
+
+static void check_tiles_with_items( const map &here, const tripoint_bub_ms &center, int range )
+{
+    std::vector<tripoint_bub_ms> indexed = here.tiles_with_items( center, range );
+    std::sort( indexed.begin(), indexed.end() );
+    std::vector<tripoint_bub_ms> scanned = scan_tiles_with_items( here, center, range );
+    std::sort( scanned.begin(), scanned.end() );
+    CHECK( indexed == scanned );
+}
+
+TEST_CASE( "tiles_with_items_follow_item_changes", "[map]" )
+{
+    map &here = get_map();
+    clear_map();
+    // Close to a submap corner, so the area spans several submaps
+    const tripoint_bub_ms center( SEEX * 5, SEEY * 5, 0 );
+    const int range = 6;
+    const tripoint_bub_ms near_corner = center + tripoint_north_west;
+    const tripoint_bub_ms across_border = center + tripoint( 3, 2, 0 );
+    const tripoint_bub_ms at_edge = center + tripoint( -range, range, 0 );
+    const tripoint_bub_ms out_of_range = center + tripoint( range + 1, 0, 0 );
+
+    check_tiles_with_items( here, center, range );
+    CHECK( here.tiles_with_items( center, range ).empty() );
+
+    here.add_item( near_corner, item( "rock" ) );
+    item &rock = here.add_item( across_border, item( "rock" ) );
+    here.add_item( at_edge, item( "rock" ) );
+    here.add_item( at_edge, item( "rock" ) );
+    here.add_item( out_of_range, item( "rock" ) );
+    check_tiles_with_items( here, center, range );
+    CHECK( here.tiles_with_items( center, range ).size() == 3 );
+
+    SECTION( "removing the only item of a tile" ) {
+        here.i_rem( across_border, &rock );
+        check_tiles_with_items( here, center, range );
+        CHECK( here.tiles_with_items( center, range ).size() == 2 );
+    }
+    SECTION( "removing one of several items of a tile" ) {
+        here.i_rem( at_edge, &*here.i_at( at_edge ).begin() );
+        check_tiles_with_items( here, center, range );
+        CHECK( here.tiles_with_items( center, range ).size() == 3 );
+    }
+    SECTION( "clearing a tile" ) {
+        here.i_clear( at_edge );
+        check_tiles_with_items( here, center, range );
+        CHECK( here.tiles_with_items( center, range ).size() == 2 );
+    }
+    SECTION( "removing through an item location" ) {
+        item_location loc( map_cursor( near_corner ), &here.i_at( near_corner ).only_item() );
+        loc.remove_item();
+        check_tiles_with_items( here, center, range );
+        CHECK( here.tiles_with_items( center, range ).size() == 2 );
+    }
+}
+
+static void remove_saved_maps()
+{
+    fs::remove_all( fs::u8path( PATH_INFO::world_base_save_path() ) / "maps" );
+}
+
+// Generates the quads and makes their first submap non-uniform, then saves them, leaving them
+// on disk only
+static void save_quads_to_disk( const std::vector<tripoint_abs_omt> &quads )
+{
+    for( const tripoint_abs_omt &quad : quads ) {
+        tinymap tm;
+        tm.load( quad, false );
+        tm.ter_set( tripoint_omt_ms( 1, 1, quad.z() ), ter_t_wall.id() );
+    }
+    MAPBUFFER.save();
+}
+
+TEST_CASE( "prefetched_quads_load_like_regular_ones", "[map][mapbuffer]" )
+{
+    clear_map();
+    remove_saved_maps();
+    on_out_of_scope cleanup( []() {
+        remove_saved_maps();
+    } );
+    const tripoint_abs_omt quad =
+        project_to<coords::omt>( get_map().get_abs_sub() ) + point_rel_omt( 20, 0 );
+    save_quads_to_disk( { quad } );
+
+    const int hits = MAPBUFFER.get_prefetch_hits();
+    MAPBUFFER.prefetch( { quad } );
+    MAPBUFFER.wait_for_prefetch();
+    submap *loaded = MAPBUFFER.lookup_submap( project_to<coords::sm>( quad ) );
+    REQUIRE( loaded != nullptr );
+    CHECK( MAPBUFFER.get_prefetch_hits() == hits + 1 );
+    CHECK( loaded->get_ter( point_sm_ms( 1, 1 ) ) == ter_t_wall.id() );
+
+    // Quads that were never generated have no file, so there is nothing to prefetch
+    const tripoint_abs_omt new_quad = quad + point_rel_omt( 20, 0 );
+    MAPBUFFER.prefetch( { new_quad } );
+    MAPBUFFER.wait_for_prefetch();
+    CHECK( MAPBUFFER.lookup_submap( project_to<coords::sm>( new_quad ) ) == nullptr );
+    CHECK( MAPBUFFER.get_prefetch_hits() == hits + 1 );
+}
+
+TEST_CASE( "corrupt_prefetched_quads_fall_back_to_a_regular_read", "[map][mapbuffer]" )
+{
+    clear_map();
+    remove_saved_maps();
+    on_out_of_scope cleanup( []() {
+        remove_saved_maps();
+    } );
+    const tripoint_abs_omt quad =
+        project_to<coords::omt>( get_map().get_abs_sub() ) + point_rel_omt( 20, 0 );
+    save_quads_to_disk( { quad } );
+    // Valid JSON that is not a valid submap, so only reading the submaps fails
+    const std::string quad_file = string_format( "%d.%d.%d.map", quad.x(), quad.y(), quad.z() );
+    bool found = false;
+    for( const fs::directory_entry &entry : fs::recursive_directory_iterator(
+             fs::u8path( PATH_INFO::world_base_save_path() ) / "maps" ) ) {
+        if( entry.path().filename().u8string() == quad_file ) {
+            write_to_file( entry.path().u8string(), []( std::ostream & fout ) {
+                fout << R"([{"version":33,"coordinates":"here"}])";
+            } );
+            found = true;
+        }
+    }
+    REQUIRE( found );
+
+    const int hits = MAPBUFFER.get_prefetch_hits();
+    MAPBUFFER.prefetch( { quad } );
+    MAPBUFFER.wait_for_prefetch();
+    const std::string msg = capture_debugmsg_during( [&]() {
+        CHECK( MAPBUFFER.lookup_submap( project_to<coords::sm>( quad ) ) == nullptr );
+    } );
+    CHECK_THAT( msg, Catch::Contains( "Failed to read prefetched" ) );
+    CHECK_THAT( msg, Catch::Contains( quad_file ) );
+    CHECK( MAPBUFFER.get_prefetch_hits() == hits );
+}
+
+TEST_CASE( "submap_prefetch_benchmark", "[.][map][mapbuffer][benchmark]" )
+{
+    clear_map();
+    remove_saved_maps();
+    on_out_of_scope cleanup( []() {
+        remove_saved_maps();
+    } );
+    // One column of quads on every z-level, like the edge of the map after a shift
+    std::vector<tripoint_abs_omt> column;
+    const tripoint_abs_omt origin =
+        project_to<coords::omt>( get_map().get_abs_sub() ) + point_rel_omt( 20, 0 );
+    for( int y = 0; y < MAPSIZE / 2; y++ ) {
+        for( int z = -OVERMAP_DEPTH; z <= OVERMAP_HEIGHT; z++ ) {
+            column.emplace_back( origin.x(), origin.y() + y, z );
+        }
+    }
+    for( const tripoint_abs_omt &quad : column ) {
+        save_quads_to_disk( { quad } );
+    }
+    const auto load_column = [&]() {
+        for( const tripoint_abs_omt &quad : column ) {
+            MAPBUFFER.lookup_submap( project_to<coords::sm>( quad ) );
+        }
+    };
+
+    BENCHMARK_ADVANCED( "load a saved map column" )( Catch::Benchmark::Chronometer meter ) {
+        MAPBUFFER.save();
+        meter.measure( load_column );
+    };
+    BENCHMARK_ADVANCED( "load a prefetched map column" )( Catch::Benchmark::Chronometer meter ) {
+        MAPBUFFER.save();
+        MAPBUFFER.prefetch( column );
+        MAPBUFFER.wait_for_prefetch();
+        meter.measure( load_column );
+    };
+}
+
+static std::vector<std::pair<ter_id, furn_id>> quad_contents( const tripoint_abs_omt &quad )
+{
+    std::vector<std::pair<ter_id, furn_id>> result;
+    const tripoint_abs_sm base = project_to<coords::sm>( quad );
+    for( const point &offset : {
+             point_zero, point_east, point_south, point_south_east
+         } ) {
+        const submap *sm = MAPBUFFER.lookup_submap( base + offset );
+        REQUIRE( sm != nullptr );
+        for( int x = 0; x < SEEX; x++ ) {
+            for( int y = 0; y < SEEY; y++ ) {
+                result.emplace_back( sm->get_ter( point_sm_ms( x, y ) ), sm->get_furn( point_sm_ms( x, y ) ) );
+            }
+        }
+    }
+    return result;
+}
+
+TEST_CASE( "speculative_mapgen_matches_regular_generation", "[map][mapgen]" )
+{
+    clear_map();
+    speculative_mapgen = true;
+    on_out_of_scope cleanup( []() {
+        speculative_mapgen = false;
+        MAPBUFFER.clear_outside_reality_bubble();
+    } );
+    map &here = get_map();
+    tripoint_abs_omt quad =
+        project_to<coords::omt>( here.get_abs_sub() ) + point_rel_omt( 20, 0 );
+    // Overmap specials choose their mapgen parameters only once, with random numbers
+    while( overmap_buffer.overmap_special_at( quad ) ) {
+        quad = quad + point_rel_omt( 1, 0 );
+    }
+    // Mapgen looks at the surrounding overmap terrain, make sure generating it does not use up
+    // random numbers during mapgen
+    for( int dx = -5; dx <= 5; dx++ ) {
+        for( int dy = -5; dy <= 5; dy++ ) {
+            overmap_buffer.ter( quad + point_rel_omt( dx, dy ) );
+        }
+    }
+    MAPBUFFER.clear_outside_reality_bubble();
+    REQUIRE( !MAPBUFFER.quad_generated( quad ) );
+
+    const cata_default_random_engine engine_before = rng_get_engine();
+    here.queue_mapgen_ahead( { quad } );
+    here.generate_ahead( std::chrono::microseconds( 0 ) );
+    REQUIRE( MAPBUFFER.quad_generated( quad ) );
+    // Generating ahead does not disturb the random numbers of everything else
+    CHECK( rng_get_engine() == engine_before );
+    const std::vector<std::pair<ter_id, furn_id>> generated_ahead = quad_contents( quad );
+
+    MAPBUFFER.clear_outside_reality_bubble();
+    REQUIRE( !MAPBUFFER.quad_generated( quad ) );
+    tinymap tm;
+    tm.load( quad, false );
+    CHECK( quad_contents( quad ) == generated_ahead );
+}
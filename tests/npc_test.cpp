@@ -11,6 +11,7 @@
 #include "cata_catch.h"
 #include "character.h"
 #include "common_types.h"
+#include "coordinates.h"
 #include "creature_tracker.h"
 #include "faction.h"
 #include "field.h"
@@ -20,7 +21,9 @@
 #include "map.h"
 #include "map_helpers.h"
 #include "memory_fast.h"
+#include "monster.h"
 #include "npc.h"
+#include "npc_threat.h"
 #include "npctalk.h"
 #include "overmapbuffer.h"
 #include "pathfinding.h"
@@ -653,3 +656,126 @@ TEST_CASE( "npc_prefers_guns", "[npc_ai]" )
     CAPTURE( hostile.get_wielded_item().get_item()->tname() );
     REQUIRE( hostile.get_wielded_item().get_item()->is_gun() );
 }
+
+namespace
+{
+struct threat_scenario {
+    std::vector<npc *> npcs;
+    std::vector<monster *> monsters;
+};
+
+threat_scenario spawn_threat_scenario( int num_npcs, int num_monsters )
+{
+    g->faction_manager_ptr->create_if_needed();
+    clear_map();
+    clear_avatar();
+    set_time_to_day();
+    npc_threat_field::set_enabled( true );
+
+    threat_scenario ret;
+    const point_bub_ms origin = get_player_character().pos_bub().xy();
+    for( int i = 0; i < num_npcs; i++ ) {
+        npc &guy = spawn_npc( origin + point( i % 5 - 2, i / 5 + 2 ), "thug" );
+        guy.set_attitude( NPCATT_FOLLOW );
+        ret.npcs.emplace_back( &guy );
+    }
+    for( int i = 0; i < num_monsters; i++ ) {
+        const tripoint_bub_ms where( origin.x() + i % 10 - 5, origin.y() - 6 - i / 10, 0 );
+        ret.monsters.emplace_back( &spawn_test_monster( "mon_zombie", where ) );
+    }
+    return ret;
+}
+} // namespace
+
+TEST_CASE( "npc_threat_field_matches_fresh_evaluation", "[npc_ai]" )
+{
+    threat_scenario scenario = spawn_threat_scenario( 6, 12 );
+    // Hurt one monster so health scaling is exercised
+    scenario.monsters.front()->set_hp( scenario.monsters.front()->get_hp_max() / 2 );
+
+    npc_threat_field &field = get_npc_threat_field();
+    for( npc *guy : scenario.npcs ) {
+        for( monster *critter : scenario.monsters ) {
+            const int dist = rl_dist( guy->pos_bub(), critter->pos_bub() );
+            CHECK( guy->evaluate_monster( *critter, dist ) == npc_threat_field::scale_by_distance(
+                       npc_threat_field::get_monster_threat( *critter ), dist ) );
+        }
+    }
+
+    SECTION( "monster threat follows changes to the monster" ) {
+        monster &critter = *scenario.monsters.back();
+        npc &guy = *scenario.npcs.front();
+        const float healthy = guy.evaluate_monster( critter, 3 );
+        critter.set_hp( 1 );
+        CHECK( guy.evaluate_monster( critter, 3 ) < healthy );
+    }
+
+    SECTION( "danger assessment does not change with the field" ) {
+        for( npc *guy : scenario.npcs ) {
+            npc_threat_field::set_enabled( false );
+            guy->regen_ai_cache();
+            const float fresh_danger = guy->danger_assessment();
+            const Creature *fresh_target = guy->current_target();
+            npc_threat_field::set_enabled( true );
+            guy->regen_ai_cache();
+            CHECK( guy->danger_assessment() == Approx( fresh_danger ) );
+            CHECK( guy->current_target() == fresh_target );
+        }
+    }
+
+    SECTION( "danger per tile" ) {
+        npc &guy = *scenario.npcs.front();
+        const tripoint_abs_ms where = guy.get_location();
+        float expected = 0.0f;
+        for( monster *critter : scenario.monsters ) {
+            const int dist = rl_dist( where, critter->get_location() );
+            expected += npc_threat_field::scale_by_distance(
+                            npc_threat_field::get_monster_threat( *critter ), dist );
+        }
+        field.reset_counters();
+        CHECK( field.danger_at( guy, where ) == Approx( expected ) );
+        CHECK( field.danger_at( guy, where ) == Approx( expected ) );
+        CHECK( field.get_counters().hits == 1 );
+        // Danger falls off as we move away from the horde
+        CHECK( field.danger_at( guy, where + tripoint( 0, 10, 0 ) ) < field.danger_at( guy, where ) );
+    }
+
+    SECTION( "danger per tile counts hostile characters" ) {
+        npc &guy = *scenario.npcs.front();
+        const tripoint_abs_ms where = guy.get_location();
+        guy.regen_ai_cache();
+        const float without = field.danger_at( guy, where );
+        npc &bandit = spawn_npc( guy.pos_bub().xy() + point( 3, 0 ), "thug" );
+        bandit.set_attitude( NPCATT_KILL );
+        guy.regen_ai_cache();
+        REQUIRE( guy.hostile_character_danger_at( where ) > 0.0f );
+        CHECK( field.danger_at( guy, where ) ==
+               Approx( without + guy.hostile_character_danger_at( where ) ) );
+    }
+}
+
+TEST_CASE( "npc_threat_field_benchmark", "[.][npc_ai][benchmark]" )
+{
+    threat_scenario scenario = spawn_threat_scenario( 15, 30 );
+    npc_threat_field &field = get_npc_threat_field();
+    // Every NPC rating the tiles around it, as when the group looks for retreat spots
+    const auto rate_retreat_spots = [&]() {
+        float total = 0.0f;
+        for( npc *guy : scenario.npcs ) {
+            for( const tripoint_abs_ms &p : closest_points_first( guy->get_location(), 1 ) ) {
+                total += field.danger_at( *guy, p );
+            }
+        }
+        return total;
+    };
+
+    BENCHMARK( "danger per tile, shared threat field" ) {
+        npc_threat_field::set_enabled( true );
+        return rate_retreat_spots();
+    };
+    BENCHMARK( "danger per tile, per NPC evaluation" ) {
+        npc_threat_field::set_enabled( false );
+        return rate_retreat_spots();
+    };
+    npc_threat_field::set_enabled( true );
+}
@@ -1,5 +1,11 @@
+#include <string>
+#include <vector>
+
 #include "cata_catch.h"
+#include "cata_scope_helpers.h"
 #include "options.h"
+#include "options_helpers.h"
+#include "worldfactory.h"
 
 static const option_slider_id option_slider_test_world_difficulty( "test_world_difficulty" );
 
@@ -73,3 +79,89 @@ TEST_CASE( "option_slider_test", "[option]" )
     }
     CHECK( checked == 7 );
 }
+
+TEST_CASE( "option_handles_follow_option_changes", "[option]" )
+{
+    static const option_handle<bool> option_FORCE_REDRAW( "FORCE_REDRAW" );
+    static const option_handle<int> option_AUTOSAVE_TURNS( "AUTOSAVE_TURNS" );
+    static const option_handle<std::string> option_ETERNAL_WEATHER( "ETERNAL_WEATHER" );
+
+    CHECK( option_FORCE_REDRAW.get() == get_option<bool>( "FORCE_REDRAW" ) );
+    CHECK( option_AUTOSAVE_TURNS.get() == get_option<int>( "AUTOSAVE_TURNS" ) );
+    CHECK( option_ETERNAL_WEATHER.get() == get_option<std::string>( "ETERNAL_WEATHER" ) );
+    {
+        override_option redraw( "FORCE_REDRAW", get_option<bool>( "FORCE_REDRAW" ) ? "false" : "true" );
+        override_option turns( "AUTOSAVE_TURNS", "77" );
+        override_option weather( "ETERNAL_WEATHER", "clear" );
+        CHECK( option_FORCE_REDRAW.get() == get_option<bool>( "FORCE_REDRAW" ) );
+        CHECK( option_AUTOSAVE_TURNS.get() == 77 );
+        CHECK( option_ETERNAL_WEATHER.get() == "clear" );
+    }
+    CHECK( option_FORCE_REDRAW.get() == get_option<bool>( "FORCE_REDRAW" ) );
+    CHECK( option_AUTOSAVE_TURNS.get() == get_option<int>( "AUTOSAVE_TURNS" ) );
+    CHECK( option_ETERNAL_WEATHER.get() == get_option<std::string>( "ETERNAL_WEATHER" ) );
+}
+
+TEST_CASE( "option_handles_follow_world_options", "[option]" )
+{
+    static const option_handle<float> option_MONSTER_UPGRADE_FACTOR( "MONSTER_UPGRADE_FACTOR" );
+
+    const float active_factor = get_option<float>( "MONSTER_UPGRADE_FACTOR" );
+    CHECK( option_MONSTER_UPGRADE_FACTOR.get() == active_factor );
+
+    options_manager::options_container world = get_options().get_world_defaults();
+    world["MONSTER_UPGRADE_FACTOR"].setValue( 2.5f );
+    {
+        on_out_of_scope restore_world( []() {
+            get_options().set_world_options( world_generator->active_world ?
+                                             &world_generator->active_world->WORLD_OPTIONS : nullptr );
+        } );
+        get_options().set_world_options( &world );
+        CHECK( option_MONSTER_UPGRADE_FACTOR.get() == 2.5f );
+        world["MONSTER_UPGRADE_FACTOR"].setValue( 1.5f );
+        CHECK( option_MONSTER_UPGRADE_FACTOR.get() == 1.5f );
+    }
+    CHECK( option_MONSTER_UPGRADE_FACTOR.get() == active_factor );
+}
+
+TEST_CASE( "option_handles_name_existing_options", "[option]" )
+{
+    const std::vector<std::string> &names = option_handle_base::registered_names();
+    CHECK( !names.empty() );
+    for( const std::string &name : names ) {
+        CAPTURE( name );
+        CHECK( has_option( name ) );
+    }
+}
+
+TEST_CASE( "option_reads_in_the_turn_loop_benchmark", "[.][option][benchmark]" )
+{
+    static const option_handle<bool> option_AUTOSAVE( "AUTOSAVE" );
+    static const option_handle<int> option_AUTOSAVE_TURNS( "AUTOSAVE_TURNS" );
+    static const option_handle<std::string> option_ETERNAL_WEATHER( "ETERNAL_WEATHER" );
+    static const option_handle<bool> option_FORCE_REDRAW( "FORCE_REDRAW" );
+    static const option_handle<float> option_MONSTER_UPGRADE_FACTOR( "MONSTER_UPGRADE_FACTOR" );
+    // Roughly what a turn with a few hundred monsters reads
+    const int monsters = 300;
+
+    BENCHMARK( "get_option" ) {
+        int reads = 0;
+        reads += get_option<bool>( "AUTOSAVE" ) ? get_option<int>( "AUTOSAVE_TURNS" ) : 0;
+        reads += get_option<std::string>( "ETERNAL_WEATHER" ) != "normal" ? 1 : 0;
+        reads += get_option<bool>( "FORCE_REDRAW" ) ? 1 : 0;
+        for( int i = 0; i < monsters; i++ ) {
+            reads += get_option<float>( "MONSTER_UPGRADE_FACTOR" ) > 0.0 ? 1 : 0;
+        }
+        return reads;
+    };
+    BENCHMARK( "option_handle" ) {
+        int reads = 0;
+        reads += option_AUTOSAVE.get() ? option_AUTOSAVE_TURNS.get() : 0;
+        reads += option_ETERNAL_WEATHER.get() != "normal" ? 1 : 0;
+        reads += option_FORCE_REDRAW.get() ? 1 : 0;
+        for( int i = 0; i < monsters; i++ ) {
+            reads += option_MONSTER_UPGRADE_FACTOR.get() > 0.0 ? 1 : 0;
+        }
+        return reads;
+    };
+}
@@ -5,10 +5,12 @@
 #include "ammo.h"
 #include "calendar.h"
 #include "cata_catch.h"
+#include "cata_scope_helpers.h"
 #include "city.h"
 #include "common_types.h"
 #include "coordinates.h"
 #include "enums.h"
+#include "filesystem.h"
 #include "game.h"
 #include "game_constants.h"
 #include "global_vars.h"
@@ -24,6 +26,7 @@
 #include "overmapbuffer.h"
 #include "test_data.h"
 #include "type_id.h"
+#include "uistate.h"
 #include "vehicle.h"
 #include "vpart_position.h"
 
@@ -622,3 +625,193 @@ TEST_CASE( "overmap_terrain_coverage", "[overmap][slow]" )
         }
     }
 }
+
+static void remove_overmap_files( const point_abs_om &p )
+{
+    remove_file( overmapbuffer::terrain_filename( p ).get_unrelative_path() );
+    remove_file( overmapbuffer::player_filename( p ).get_unrelative_path() );
+}
+
+TEST_CASE( "overmap_save_only_writes_changed_files", "[overmap][slow]" )
+{
+    const point_abs_om where( 40, 40 );
+    overmap_buffer.clear();
+    remove_overmap_files( where );
+    on_out_of_scope cleanup( [&]() {
+        overmap_buffer.clear();
+        remove_overmap_files( where );
+    } );
+
+    overmap &om = overmap_buffer.get( where );
+    overmap::save_counters &counters = overmap::get_save_counters();
+    const tripoint_om_omt p( 1, 1, 0 );
+    REQUIRE( om.ter( p ) != oter_cabin.id() );
+
+    counters = {};
+    om.save();
+    CHECK( counters.view_writes == 1 );
+    CHECK( counters.terrain_writes == 1 );
+    CHECK( counters.layer_rebuilds == 1 );
+
+    counters = {};
+    om.save();
+    CHECK( counters.view_writes == 0 );
+    CHECK( counters.terrain_writes == 0 );
+    CHECK( counters.skipped_writes == 2 );
+    CHECK( counters.layer_rebuilds == 0 );
+
+    counters = {};
+    om.set_seen( p, om_vision_level::full );
+    om.save();
+    CHECK( counters.view_writes == 1 );
+    CHECK( counters.terrain_writes == 0 );
+
+    counters = {};
+    om.ter_set( p, oter_cabin.id() );
+    om.save();
+    CHECK( counters.view_writes == 0 );
+    CHECK( counters.terrain_writes == 1 );
+    CHECK( counters.layer_rebuilds == 1 );
+
+    // Both changes made it to disk
+    overmap_buffer.clear();
+    overmap &loaded = overmap_buffer.get( where );
+    CHECK( loaded.ter( p ) == oter_cabin.id() );
+    CHECK( loaded.seen( p ) == om_vision_level::full );
+
+    // A freshly loaded view is already on disk, the terrain file is written once more because
+    // the hash of its content is not known after loading.
+    counters = {};
+    loaded.save();
+    CHECK( counters.view_writes == 0 );
+    CHECK( counters.terrain_writes == 1 );
+}
+
+TEST_CASE( "overmap_autosave_benchmark", "[.][overmap][benchmark]" )
+{
+    overmap_buffer.clear();
+    std::vector<point_abs_om> loaded;
+    on_out_of_scope cleanup( [&]() {
+        overmap_buffer.clear();
+        for( const point_abs_om &p : loaded ) {
+            remove_overmap_files( p );
+        }
+    } );
+    for( const point_abs_om &p : closest_points_first( point_abs_om( 40, 40 ), 2 ) ) {
+        remove_overmap_files( p );
+        overmap_buffer.get( p );
+        loaded.push_back( p );
+    }
+    REQUIRE( loaded.size() == 25 );
+    overmap_buffer.save();
+
+    overmap &om = overmap_buffer.get( loaded.front() );
+    const tripoint_om_omt p( 1, 1, 0 );
+    BENCHMARK( "autosave, nothing changed" ) {
+        overmap_buffer.save();
+    };
+    BENCHMARK( "autosave, one overmap view changed" ) {
+        om.set_seen( p, om_vision_level::full, true );
+        om.set_seen( p, om_vision_level::unseen, true );
+        overmap_buffer.save();
+    };
+    BENCHMARK( "autosave, one overmap terrain set and reverted" ) {
+        const oter_id old = om.ter( p );
+        om.ter_set( p, oter_cabin.id() );
+        om.ter_set( p, old );
+        overmap_buffer.save();
+    };
+}
+
+// Looks up every tile of a view of the given size with its top left corner at corner
+static void look_at_view( const tripoint_abs_omt &corner, const point &size )
+{
+    for( int y = 0; y < size.y; y++ ) {
+        for( int x = 0; x < size.x; x++ ) {
+            oter_display_cache::get( corner + point( x, y ) );
+        }
+    }
+}
+
+TEST_CASE( "overmap_view_cache_only_looks_up_new_tiles", "[overmap][slow]" )
+{
+    overmap_buffer.clear();
+    on_out_of_scope cleanup( []() {
+        overmap_buffer.clear();
+        oter_display_cache::clear();
+    } );
+    const point_abs_om where( 40, 40 );
+    overmap &om = overmap_buffer.get( where );
+    const tripoint_abs_omt corner = project_combine( where, tripoint_om_omt( 10, 10, 0 ) );
+    const point size( 30, 20 );
+    for( int y = 0; y < size.y + 1; y++ ) {
+        for( int x = 0; x < size.x + 1; x++ ) {
+            overmap_buffer.set_seen( corner + point( x, y ), om_vision_level::full );
+        }
+    }
+    oter_display_cache::clear();
+    oter_display_cache::counters &counters = oter_display_cache::get_counters();
+
+    counters = {};
+    look_at_view( corner, size );
+    CHECK( counters.misses == size.x * size.y );
+    look_at_view( corner, size );
+    CHECK( counters.misses == size.x * size.y );
+    CHECK( counters.hits == size.x * size.y );
+
+    // Panning one tile to the right only looks up the new column
+    counters = {};
+    look_at_view( corner + point_east, size );
+    CHECK( counters.misses == size.y );
+
+    // Edits are visible right away
+    const tripoint_abs_omt edited = corner + point( 3, 3 );
+    const tripoint_om_omt local = project_remain<coords::om>( edited ).remainder_tripoint;
+    om.ter_set( local, oter_cabin.id() );
+    CHECK( oter_display_cache::get( edited ).shown == oter_cabin.id() );
+    CHECK( oter_display_cache::get( edited ).sym == oter_cabin->get_symbol( om_vision_level::full ) );
+    om.set_seen( local, om_vision_level::outlines, true );
+    CHECK( oter_display_cache::get( edited ).vision == om_vision_level::outlines );
+    CHECK( oter_display_cache::get( edited + point_east ).vision == om_vision_level::full );
+
+    // So are display settings
+    const bool land_use_codes = uistate.overmap_show_land_use_codes;
+    on_out_of_scope restore_land_use_codes( [&]() {
+        uistate.overmap_show_land_use_codes = land_use_codes;
+    } );
+    uistate.overmap_show_land_use_codes = !land_use_codes;
+    counters = {};
+    look_at_view( corner, size );
+    CHECK( counters.clears == 1 );
+    CHECK( counters.misses == size.x * size.y );
+}
+
+TEST_CASE( "overmap_view_panning_benchmark", "[.][overmap][benchmark]" )
+{
+    overmap_buffer.clear();
+    on_out_of_scope cleanup( []() {
+        overmap_buffer.clear();
+        oter_display_cache::clear();
+    } );
+    const point_abs_om where( 40, 40 );
+    overmap_buffer.get( where );
+    const tripoint_abs_omt corner = project_combine( where, tripoint_om_omt( 10, 10, 0 ) );
+    const point size( 120, 50 );
+    for( int y = 0; y < size.y; y++ ) {
+        for( int x = 0; x < size.x + 20; x++ ) {
+            overmap_buffer.set_seen( corner + point( x, y ), om_vision_level::full );
+        }
+    }
+
+    BENCHMARK( "pan 20 tiles, looking up every tile" ) {
+        for( int step = 0; step < 20; step++ ) {
+            oter_display_cache::clear();
+            look_at_view( corner + point( step, 0 ), size );
+        }
+    };
+    BENCHMARK( "pan 20 tiles, cached" ) {
+        for( int step = 0; step < 20; step++ ) {
+            look_at_view( corner + point( step, 0 ), size );
+        }
+    };
+}
@@ -1,8 +1,13 @@
+#include <array>
+#include <cmath>
+#include <cstdint>
 #include <functional>
 #include <optional>
 #include <vector>
 
+#include "calendar.h"
 #include "cata_catch.h"
+#include "point.h"
 #include "rng.h"
 #include "test_statistics.h"
 
@@ -78,3 +83,166 @@ TEST_CASE( "random_entry_preserves_constness", "[rng]" )
     i1 = 5678;
     CHECK( v1[0] == 5678 );
 }
+
+static std::vector<int> draw_from( rng_stream stream, int count )
+{
+    std::vector<int> ret;
+    rng_stream_scope scope( stream );
+    for( int i = 0; i < count; i++ ) {
+        ret.push_back( rng( 0, 1000000 ) );
+    }
+    return ret;
+}
+
+TEST_CASE( "rng_stream_depends_only_on_its_key", "[rng]" )
+{
+    const rng_stream root( 1234 );
+    CHECK( draw_from( root, 20 ) == draw_from( rng_stream( 1234 ), 20 ) );
+    CHECK( draw_from( root, 20 ) != draw_from( rng_stream( 1235 ), 20 ) );
+
+    // Children don't depend on what was drawn from the parent
+    rng_stream used( 1234 );
+    draw_from( used, 20 );
+    {
+        rng_stream_scope scope( used );
+        rng( 0, 10 );
+    }
+    CHECK( draw_from( used.fork( 7 ), 20 ) == draw_from( root.fork( 7 ), 20 ) );
+
+    // ... but they do depend on the keys, and their order
+    const point sm( 3, -4 );
+    const time_point turn = calendar::turn_zero + 5_turns;
+    CHECK( root.fork( sm ).fork( turn ).get_key() == root.fork( sm ).fork( turn ).get_key() );
+    CHECK( root.fork( sm ).fork( turn ).get_key() != root.fork( turn ).fork( sm ).get_key() );
+    CHECK( root.fork( sm ).get_key() != root.fork( point( -4, 3 ) ).get_key() );
+    CHECK( root.fork( tripoint( sm, 0 ) ).get_key() != root.fork( tripoint( sm, 1 ) ).get_key() );
+    CHECK( root.fork( 1 ).get_key() != rng_stream( 1235 ).fork( 1 ).get_key() );
+}
+
+TEST_CASE( "rng_stream_scope_restores_the_previous_engine", "[rng]" )
+{
+    rng_set_engine_seed( 42 );
+    const int first = rng( 0, 1000000 );
+    const int second = rng( 0, 1000000 );
+
+    rng_set_engine_seed( 42 );
+    CHECK( rng( 0, 1000000 ) == first );
+    rng_stream outer( 1 );
+    const std::vector<int> expected_outer = draw_from( rng_stream( 1 ), 2 );
+    {
+        rng_stream_scope outer_scope( outer );
+        CHECK( rng( 0, 1000000 ) == expected_outer[0] );
+        {
+            rng_stream_scope inner_scope( 99 );
+            rng( 0, 1000000 );
+        }
+        // The outer stream continues where it was
+        CHECK( rng( 0, 1000000 ) == expected_outer[1] );
+    }
+    CHECK( rng( 0, 1000000 ) == second );
+}
+
+// Pearson's chi-squared statistic of counts that should all be equal
+static double chi_squared( const std::vector<int> &counts )
+{
+    double total = 0;
+    for( int c : counts ) {
+        total += c;
+    }
+    const double expected = total / counts.size();
+    double ret = 0;
+    for( int c : counts ) {
+        ret += ( c - expected ) * ( c - expected ) / expected;
+    }
+    return ret;
+}
+
+// Critical value of the chi-squared distribution with 9 degrees of freedom at p = 0.001
+static constexpr double chi_squared_9_critical = 27.88;
+
+TEST_CASE( "rng_stream_statistical_quality", "[rng]" )
+{
+    const rng_stream root( 20240501 );
+
+    SECTION( "draws within a stream are uniform" ) {
+        for( std::uint64_t key = 0; key < 4; key++ ) {
+            CAPTURE( key );
+            rng_stream stream = root.fork( key );
+            rng_stream_scope scope( stream );
+            std::vector<int> counts( 10 );
+            for( int i = 0; i < 100000; i++ ) {
+                counts[rng( 0, 9 )]++;
+            }
+            CHECK( chi_squared( counts ) < chi_squared_9_critical );
+        }
+    }
+
+    // Streams keyed by neighbouring submaps and turns are the common case, their first numbers
+    // must not follow the keys
+    SECTION( "first draws of sibling streams are uniform" ) {
+        std::vector<int> by_point( 10 );
+        std::vector<int> by_turn( 10 );
+        for( int x = 0; x < 100; x++ ) {
+            for( int y = 0; y < 100; y++ ) {
+                by_point[draw_from( root.fork( point( x, y ) ), 1 )[0] % 10]++;
+            }
+        }
+        for( int t = 0; t < 10000; t++ ) {
+            const time_point turn = calendar::turn_zero + time_duration::from_turns( t );
+            by_turn[draw_from( root.fork( turn ), 1 )[0] % 10]++;
+        }
+        CHECK( chi_squared( by_point ) < chi_squared_9_critical );
+        CHECK( chi_squared( by_turn ) < chi_squared_9_critical );
+    }
+
+    SECTION( "sibling streams are uncorrelated" ) {
+        const int n = 10000;
+        std::vector<double> first( n + 1 );
+        for( int k = 0; k <= n; k++ ) {
+            first[k] = draw_from( root.fork( static_cast<std::uint64_t>( k ) ), 1 )[0];
+        }
+        // Correlation of the first draws of streams k and k + 1
+        double mean = 0;
+        for( int k = 0; k < n; k++ ) {
+            mean += first[k] / n;
+        }
+        double covariance = 0;
+        double variance = 0;
+        for( int k = 0; k < n; k++ ) {
+            covariance += ( first[k] - mean ) * ( first[k + 1] - mean );
+            variance += ( first[k] - mean ) * ( first[k] - mean );
+        }
+        // The standard error is about 1 / sqrt( n ) = 0.01
+        CHECK( std::abs( covariance / variance ) < 0.05 );
+    }
+}
+
+TEST_CASE( "rng_stream_benchmark", "[.][rng][benchmark]" )
+{
+    BENCHMARK( "global engine" ) {
+        int total = 0;
+        for( int i = 0; i < 1000; i++ ) {
+            total += rng( 0, 100 );
+        }
+        return total;
+    };
+    BENCHMARK( "scoped stream" ) {
+        rng_stream stream( 1234 );
+        rng_stream_scope scope( stream );
+        int total = 0;
+        for( int i = 0; i < 1000; i++ ) {
+            total += rng( 0, 100 );
+        }
+        return total;
+    };
+    BENCHMARK( "fork per submap and turn" ) {
+        const rng_stream root( 1234 );
+        std::uint64_t total = 0;
+        for( int x = 0; x < 11; x++ ) {
+            for( int y = 0; y < 11; y++ ) {
+                total += root.fork( point( x, y ) ).fork( calendar::turn ).get_key();
+            }
+        }
+        return total;
+    };
+}
@@ -2,12 +2,16 @@
 #include <array>
 #include <chrono>
 #include <cstdio>
+#include <cstring>
 #include <functional>
+#include <memory>
+#include <random>
 #include <sstream>
 #include <type_traits>
 #include <vector>
 
 #include "cata_catch.h"
+#include "cata_scope_helpers.h"
 #include "cuboid_rectangle.h"
 #include "game_constants.h"
 #include "level_cache.h"
@@ -18,6 +22,7 @@
 #include "point.h"
 #include "rng.h"
 #include "shadowcasting.h"
+#include "worker_pool.h"
 
 // Constants setting the ratio of set to unset tiles.
 static constexpr unsigned int NUMERATOR = 1;
@@ -1133,6 +1138,94 @@ TEST_CASE( "shadowcasting_float_quad_performance", "[.]" )
     shadowcasting_float_quad( 1000000, 100 );
 }
 
+struct parallel_3d_grids {
+    std::array<cata::mdarray<float, point_bub_ms>, OVERMAP_LAYERS> transparency = {};
+    std::array<cata::mdarray<bool, point_bub_ms>, OVERMAP_LAYERS> floors = {};
+    std::array<cata::mdarray<float, point_bub_ms>, OVERMAP_LAYERS> serial = {};
+    std::array<cata::mdarray<float, point_bub_ms>, OVERMAP_LAYERS> parallel = {};
+};
+
+// Random terrain over all z-levels, with floors on a third of the tiles
+static std::unique_ptr<parallel_3d_grids> make_parallel_3d_grids()
+{
+    std::unique_ptr<parallel_3d_grids> grids = std::make_unique<parallel_3d_grids>();
+    std::uniform_int_distribution<int> distribution( 0, 2 );
+    for( int z = 0; z < OVERMAP_LAYERS; z++ ) {
+        randomly_fill_transparency( grids->transparency[z] );
+        grids->floors[z].fill_from_callable( [&distribution]() {
+            return distribution( rng_get_engine() ) == 0;
+        } );
+    }
+    return grids;
+}
+
+static void cast_3d( parallel_3d_grids &grids,
+                     std::array<cata::mdarray<float, point_bub_ms>, OVERMAP_LAYERS> &out,
+                     const tripoint_bub_ms &origin, vertical_direction dir )
+{
+    array_of_grids_of<float> seen_caches;
+    array_of_grids_of<const float> transparency_caches;
+    array_of_grids_of<const bool> floor_caches;
+    for( int z = 0; z < OVERMAP_LAYERS; z++ ) {
+        seen_caches[z] = &out[z];
+        transparency_caches[z] = &grids.transparency[z];
+        floor_caches[z] = &grids.floors[z];
+    }
+    cast_zlight<float, sight_calc, sight_check, accumulate_transparency>(
+        seen_caches, transparency_caches, floor_caches, origin, 0, 1.0, dir );
+}
+
+TEST_CASE( "shadowcasting_3d_parallel_matches_serial", "[shadowcasting]" )
+{
+    std::unique_ptr<parallel_3d_grids> grids = make_parallel_3d_grids();
+    const tripoint_bub_ms origin = GENERATE( tripoint_bub_ms( 65, 65, 0 ),
+                                   tripoint_bub_ms( 10, 120, -5 ), tripoint_bub_ms( 65, 65, OVERMAP_HEIGHT ) );
+    const vertical_direction dir = GENERATE( vertical_direction::BOTH, vertical_direction::UP );
+    CAPTURE( origin, static_cast<int>( dir ) );
+
+    // Start from the same random values, as the seen cache may already hold earlier results
+    for( int z = 0; z < OVERMAP_LAYERS; z++ ) {
+        randomly_fill_transparency( grids->serial[z], 1, 2 );
+        grids->parallel[z] = grids->serial[z];
+    }
+
+    REQUIRE( get_shadowcasting_pool() == nullptr );
+    cast_3d( *grids, grids->serial, origin, dir );
+
+    worker_pool pool( 3 );
+    set_shadowcasting_pool( &pool );
+    const on_out_of_scope restore_pool( []() {
+        set_shadowcasting_pool( nullptr );
+    } );
+    cast_3d( *grids, grids->parallel, origin, dir );
+
+    for( int z = 0; z < OVERMAP_LAYERS; z++ ) {
+        CAPTURE( z - OVERMAP_DEPTH );
+        CHECK( std::memcmp( &grids->serial[z][0][0], &grids->parallel[z][0][0],
+                            sizeof( float ) * MAPSIZE_X * MAPSIZE_Y ) == 0 );
+    }
+}
+
+TEST_CASE( "shadowcasting_3d_parallel_benchmark", "[.][shadowcasting][benchmark]" )
+{
+    std::unique_ptr<parallel_3d_grids> grids = make_parallel_3d_grids();
+    const tripoint_bub_ms origin( 65, 65, 0 );
+    const on_out_of_scope restore_pool( []() {
+        set_shadowcasting_pool( nullptr );
+    } );
+
+    set_shadowcasting_pool( nullptr );
+    BENCHMARK( "serial, 21 z-levels" ) {
+        cast_3d( *grids, grids->serial, origin, vertical_direction::BOTH );
+        return grids->serial[OVERMAP_DEPTH][65][66];
+    };
+    set_shadowcasting_pool( &get_worker_pool() );
+    BENCHMARK( "parallel, 21 z-levels" ) {
+        cast_3d( *grids, grids->parallel, origin, vertical_direction::BOTH );
+        return grids->parallel[OVERMAP_DEPTH][65][66];
+    };
+}
+
 // I'm not sure this will ever work.
 TEST_CASE( "bresenham_vs_shadowcasting", "[.]" )
 {
@@ -1004,3 +1004,177 @@ TEST_CASE( "legacy_stats_tracker_save_loading", "[stats]" )
     CHECK( s.get_events( event_type::character_triggers_trap ).count() == 2 );
     CHECK( s.get_events( event_type::character_kills_monster ).count() == 0 );
 }
+
+static std::string serialize_stats( const stats_tracker &s )
+{
+    std::ostringstream os;
+    JsonOut jsout( os );
+    s.serialize( jsout );
+    return os.str();
+}
+
+static void deserialize_stats( stats_tracker &s, const std::string &json_string )
+{
+    JsonValue jsin = json_loader::from_string( json_string );
+    s.deserialize( jsin.get_object() );
+}
+
+TEST_CASE( "stats_tracker_columnar_save_round_trip", "[stats]" )
+{
+    stats_tracker s;
+    event_bus b;
+    b.subscribe( &s );
+
+    const character_id u_id = get_player_character().getID();
+    character_id other_id = u_id;
+    ++other_id;
+    constexpr event_type ckm = event_type::character_kills_monster;
+    constexpr event_type ctd = event_type::character_takes_damage;
+    const time_point start = calendar::turn;
+    for( int i = 0; i < 6; ++i ) {
+        b.send<ckm>( u_id, i % 2 ? mon_zombie : mon_dog, i );
+        b.send<ckm>( other_id, mon_zombie, i );
+        b.send<ctd>( i % 3 ? u_id : other_id, i - 2 );
+        calendar::turn += 1_minutes;
+    }
+    b.send<ckm>( u_id, mon_zombie, 1 );
+    const time_point end = calendar::turn;
+    calendar::turn = start;
+
+    const std::string json_string = serialize_stats( s );
+    // Interned values are written once, no matter how many events have them
+    const auto occurrences = [&]( const std::string & needle ) {
+        int found = 0;
+        for( size_t pos = json_string.find( needle ); pos != std::string::npos;
+             pos = json_string.find( needle, pos + 1 ) ) {
+            ++found;
+        }
+        return found;
+    };
+    CHECK( occurrences( "\"mon_zombie\"" ) == 1 );
+    CHECK( occurrences( "\"mon_dog\"" ) == 1 );
+
+    stats_tracker loaded;
+    deserialize_stats( loaded, json_string );
+    const cata::event::data_type by_u{ { "killer", cata_variant( u_id ) } };
+    const cata::event::data_type zombies_by_u{
+        { "killer", cata_variant( u_id ) }, { "victim_type", cata_variant( mon_zombie ) } };
+    cata::event::data_type last_kill = zombies_by_u;
+    last_kill.emplace( "exp", cata_variant( 1 ) );
+    for( stats_tracker *tracker : {
+             &s, &loaded
+         } ) {
+        stats_tracker &t = *tracker;
+        CHECK( t.get_events( ckm ).count() == 13 );
+        CHECK( t.get_events( ckm ).size() == 12 );
+        CHECK( t.get_events( ckm ).count( by_u ) == 7 );
+        CHECK( t.get_events( ckm ).count( zombies_by_u ) == 4 );
+        CHECK( t.get_events( ckm ).total( "exp" ) == 2 * 15 + 1 );
+        CHECK( t.get_events( ckm ).total( "exp", zombies_by_u ) == 1 + 3 + 5 + 1 );
+        CHECK( t.get_events( ckm ).maximum( "exp" ) == 5 );
+        CHECK( t.get_events( ctd ).minimum( "damage" ) == -2 );
+        CHECK( t.get_events( ctd ).total( "damage" ) == 3 );
+        CHECK( t.get_events( ckm ).first()->second.first == start );
+        CHECK( t.get_events( ckm ).last()->second.last == end );
+        CHECK( t.get_events( ckm ).last()->first == last_kill );
+    }
+    for( const event_type type : {
+             ckm, ctd
+         } ) {
+        const event_multiset::summaries_type original = s.get_events( type ).counts();
+        const event_multiset::summaries_type read_back = loaded.get_events( type ).counts();
+        CHECK( read_back.size() == original.size() );
+        for( const std::pair<const cata::event::data_type, event_summary> &p : original ) {
+            const auto it = read_back.find( p.first );
+            REQUIRE( it != read_back.end() );
+            CHECK( it->second.count == p.second.count );
+            CHECK( it->second.first == p.second.first );
+            CHECK( it->second.last == p.second.last );
+        }
+    }
+}
+
+TEST_CASE( "event_multiset_row_limit", "[stats]" )
+{
+    constexpr event_type ctd = event_type::character_takes_damage;
+    const character_id u_id = get_player_character().getID();
+    const time_point start = calendar::turn;
+    event_multiset events( ctd );
+    events.set_row_limit( 8 );
+    for( int damage = 0; damage < 20; ++damage ) {
+        events.add( cata::event( ctd, start + damage * 1_minutes, {
+            { "character", cata_variant( u_id ) }, { "damage", cata_variant( damage ) } } ) );
+        CHECK( events.size() <= 8 );
+    }
+    // The most recently seen events are kept, the older ones are forgotten
+    const cata::event::data_type oldest{ { "damage", cata_variant( 0 ) } };
+    const cata::event::data_type latest{ { "damage", cata_variant( 19 ) } };
+    CHECK( events.count( oldest ) == 0 );
+    CHECK( events.count( latest ) == 1 );
+    CHECK( events.count() == static_cast<int>( events.size() ) );
+    int total = 0;
+    int minimum = 19;
+    events.visit( [&]( const cata::event::data_type & data, const event_summary & summary ) {
+        const int damage = data.at( "damage" ).get<int>();
+        total += summary.count * damage;
+        minimum = std::min( minimum, damage );
+    } );
+    CHECK( events.total( "damage" ) == total );
+    CHECK( events.first()->second.first == start + minimum * 1_minutes );
+    CHECK( events.last()->second.last == start + 19_minutes );
+
+    stats_tracker s;
+    s.set_row_limit( ctd, 4 );
+    for( int damage = 0; damage < 10; ++damage ) {
+        s.notify( cata::event::make<ctd>( u_id, damage ) );
+    }
+    CHECK( s.get_events( ctd ).size() <= 4 );
+    stats_tracker loaded;
+    loaded.set_row_limit( ctd, 2 );
+    deserialize_stats( loaded, serialize_stats( s ) );
+    CHECK( loaded.get_events( ctd ).size() <= 2 );
+}
+
+// Roughly what five years of a busy character leave behind
+static void add_five_year_stats( stats_tracker &s )
+{
+    const std::vector<mtype_id> victims = { mon_zombie, mon_zombie_brute, mon_dog, mon_horse };
+    const time_point start = calendar::turn;
+    for( int day = 0; day < 5 * 364; ++day ) {
+        const time_point when = start + day * 1_days;
+        for( int i = 0; i < 50; ++i ) {
+            const character_id killer( i % 40 );
+            s.notify( cata::event( event_type::character_kills_monster, when, {
+                { "killer", cata_variant( killer ) },
+                { "victim_type", cata_variant( victims[( day + i ) % victims.size()] ) },
+                { "exp", cata_variant( ( day * 7 + i ) % 500 ) } } ) );
+            s.notify( cata::event( event_type::character_takes_damage, when, {
+                { "character", cata_variant( killer ) },
+                { "damage", cata_variant( ( day + i * 3 ) % 60 ) } } ) );
+        }
+    }
+}
+
+TEST_CASE( "stats_tracker_save_load_benchmark", "[.][stats][benchmark]" )
+{
+    stats_tracker s;
+    add_five_year_stats( s );
+    const std::string json_string = serialize_stats( s );
+    CAPTURE( json_string.size() );
+    stats_tracker loaded;
+    deserialize_stats( loaded, json_string );
+    CHECK( loaded.get_events( event_type::character_kills_monster ).count() == 5 * 364 * 50 );
+
+    BENCHMARK( "save" ) {
+        return serialize_stats( s ).size();
+    };
+    BENCHMARK( "load" ) {
+        stats_tracker t;
+        deserialize_stats( t, json_string );
+        return t.get_events( event_type::character_kills_monster ).size();
+    };
+    BENCHMARK( "count with criteria" ) {
+        return loaded.get_events( event_type::character_kills_monster ).count( {
+            { "victim_type", cata_variant( mon_zombie ) } } );
+    };
+}
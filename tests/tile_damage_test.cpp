@@ -0,0 +1,101 @@
+#include <cstddef>
+#include <vector>
+
+#include "cata_catch.h"
+#include "coordinates.h"
+#include "cuboid_rectangle.h"
+#include "item.h"
+#include "map.h"
+#include "map_helpers.h"
+#include "point.h"
+#include "tile_damage.h"
+#include "type_id.h"
+
+static const itype_id itype_rock( "rock" );
+
+static const ter_str_id ter_t_wall( "t_wall" );
+
+static void check_rectangle( const half_open_rectangle<point> &rect, const point &p_min,
+                             const point &p_max )
+{
+    CHECK( rect.p_min == p_min );
+    CHECK( rect.p_max == p_max );
+}
+
+TEST_CASE( "tile_damage_tracker_finds_the_changed_tiles", "[tiles]" )
+{
+    tile_damage_tracker tracker;
+    const point size( 4, 3 );
+    std::vector<std::size_t> frame( 12, 1 );
+    std::vector<half_open_rectangle<point>> damaged = tracker.update( size,
+            std::vector<std::size_t>( frame ) );
+    REQUIRE( damaged.size() == 1 );
+    check_rectangle( damaged[0], point_zero, size );
+    CHECK( tracker.update( size, std::vector<std::size_t>( frame ) ).empty() );
+
+    SECTION( "changed tiles in adjacent rows share a rectangle" ) {
+        frame[1 * size.x + 2] = 2;
+        frame[2 * size.x + 0] = 2;
+        damaged = tracker.update( size, std::vector<std::size_t>( frame ) );
+        REQUIRE( damaged.size() == 1 );
+        check_rectangle( damaged[0], point( 0, 1 ), point( 3, 3 ) );
+    }
+
+    SECTION( "changed tiles in separate rows do not" ) {
+        frame[0 * size.x + 1] = 2;
+        frame[2 * size.x + 3] = 2;
+        damaged = tracker.update( size, std::vector<std::size_t>( frame ) );
+        REQUIRE( damaged.size() == 2 );
+        check_rectangle( damaged[0], point( 1, 0 ), point( 2, 1 ) );
+        check_rectangle( damaged[1], point( 3, 2 ), point( 4, 3 ) );
+    }
+
+    SECTION( "a reset or a new size damages the whole frame" ) {
+        tracker.reset();
+        damaged = tracker.update( size, std::vector<std::size_t>( frame ) );
+        REQUIRE( damaged.size() == 1 );
+        check_rectangle( damaged[0], point_zero, size );
+        damaged = tracker.update( point( 3, 4 ), std::vector<std::size_t>( frame ) );
+        REQUIRE( damaged.size() == 1 );
+        check_rectangle( damaged[0], point_zero, point( 3, 4 ) );
+    }
+}
+
+TEST_CASE( "tiles_covering_finds_the_sprites_over_an_area", "[tiles]" )
+{
+    const point tile_size( 32, 32 );
+    // Sprites twice as high as a tile, reaching into the tile above
+    const half_open_rectangle<point> extent( point( 0, -32 ), point( 32, 32 ) );
+    const half_open_rectangle<point> area = tile_sprite_area(
+            half_open_rectangle<point>( point( 2, 3 ), point( 4, 4 ) ), tile_size, extent );
+    check_rectangle( area, point( 64, 64 ), point( 128, 128 ) );
+    // The tiles themselves, the row above them and the row below, whose
+    // sprites reach up into them
+    check_rectangle( tiles_covering( area, tile_size, extent ), point( 2, 2 ), point( 4, 5 ) );
+}
+
+TEST_CASE( "tile_contents_fingerprint_follows_the_map", "[tiles][map]" )
+{
+    clear_map();
+    map &here = get_map();
+    const tripoint_bub_ms p( 60, 60, 0 );
+    const std::size_t empty = tile_contents_fingerprint( here, p );
+    CHECK( tile_contents_fingerprint( here, p ) == empty );
+
+    SECTION( "terrain" ) {
+        here.ter_set( p, ter_t_wall );
+        CHECK( tile_contents_fingerprint( here, p ) != empty );
+    }
+    SECTION( "items" ) {
+        here.add_item( p, item( itype_rock ) );
+        CHECK( tile_contents_fingerprint( here, p ) != empty );
+    }
+    SECTION( "creatures" ) {
+        spawn_test_monster( "mon_zombie", p );
+        CHECK( tile_contents_fingerprint( here, p ) != empty );
+    }
+    SECTION( "the neighbouring tile" ) {
+        here.ter_set( p + tripoint_east, ter_t_wall );
+        CHECK( tile_contents_fingerprint( here, p ) == empty );
+    }
+}
@@ -0,0 +1,105 @@
+#include <chrono>
+#include <string>
+#include <vector>
+
+#include "cata_catch.h"
+#include "cuboid_rectangle.h"
+#include "point.h"
+#include "ui_manager.h"
+
+using namespace std::chrono_literals;
+
+TEST_CASE( "redraw_cost_keeps_last_and_average_time", "[ui]" )
+{
+    ui_adaptor::redraw_cost cost;
+    CHECK( cost.average() == 0us );
+    cost.add( 100us );
+    cost.add( 300us );
+    CHECK( cost.redraws == 2 );
+    CHECK( cost.last == 300us );
+    CHECK( cost.average() == 200us );
+}
+
+TEST_CASE( "redraw_cost_report_lists_every_ui", "[ui]" )
+{
+    const size_t lines_before = ui_adaptor::redraw_cost_report().size();
+    REQUIRE( lines_before >= 1 );
+    {
+        ui_adaptor lower;
+        ui_adaptor upper;
+        const std::vector<std::string> lines = ui_adaptor::redraw_cost_report();
+        CHECK( lines.size() == lines_before + 2 );
+        CHECK( upper.get_redraw_cost().redraws == 0 );
+    }
+    CHECK( ui_adaptor::redraw_cost_report().size() == lines_before );
+}
+
+static void check_damage( const ui_adaptor &ui, const rectangle<point> &expected )
+{
+    REQUIRE( ui.damaged_region() );
+    CHECK( ui.damaged_region()->p_min == expected.p_min );
+    CHECK( ui.damaged_region()->p_max == expected.p_max );
+}
+
+TEST_CASE( "closing_a_ui_only_damages_the_area_it_covered", "[ui]" )
+{
+    ui_adaptor lower;
+    lower.enable_partial_redraw();
+    lower.position_absolute( point_zero, point( 40, 20 ) );
+    check_damage( lower, rectangle<point>( point_zero, point( 40, 20 ) ) );
+    ui_adaptor side;
+    side.position_absolute( point( 40, 0 ), point( 10, 20 ) );
+    ui_manager::redraw_invalidated();
+    REQUIRE_FALSE( lower.damaged_region() );
+    {
+        ui_adaptor popup;
+        popup.position_absolute( point( 5, 5 ), point( 10, 4 ) );
+        ui_manager::redraw_invalidated();
+    }
+    check_damage( lower, rectangle<point>( point( 5, 5 ), point( 15, 9 ) ) );
+    CHECK_FALSE( lower.contents_invalidated() );
+    CHECK_FALSE( side.damaged_region() );
+
+    ui_manager::invalidate( rectangle<point>( point( 30, 15 ), point( 45, 25 ) ), false );
+    // The damage grows to the bounding rectangle, clipped to each UI
+    check_damage( lower, rectangle<point>( point( 5, 5 ), point( 40, 20 ) ) );
+    check_damage( side, rectangle<point>( point( 40, 15 ), point( 45, 20 ) ) );
+
+    ui_manager::redraw_invalidated();
+    CHECK_FALSE( lower.damaged_region() );
+    CHECK_FALSE( side.damaged_region() );
+}
+
+TEST_CASE( "partial_redraw_only_invalidates_the_upper_uis_it_draws_under", "[ui]" )
+{
+    ui_adaptor lower;
+    lower.position_absolute( point_zero, point( 40, 20 ) );
+    ui_adaptor left;
+    left.position_absolute( point_zero, point( 10, 10 ) );
+    ui_adaptor right;
+    right.position_absolute( point( 30, 0 ), point( 10, 10 ) );
+    ui_manager::redraw_invalidated();
+
+    SECTION( "uncovering part of a ui with partial redraw" ) {
+        lower.enable_partial_redraw();
+        ui_manager::invalidate( rectangle<point>( point( 8, 8 ), point( 12, 12 ) ), false );
+        check_damage( lower, rectangle<point>( point( 8, 8 ), point( 12, 12 ) ) );
+        check_damage( left, rectangle<point>( point( 8, 8 ), point( 10, 10 ) ) );
+        CHECK_FALSE( right.damaged_region() );
+    }
+
+    SECTION( "uncovering part of a ui that redraws all of itself" ) {
+        ui_manager::invalidate( rectangle<point>( point( 8, 8 ), point( 12, 12 ) ), false );
+        check_damage( left, rectangle<point>( point_zero, point( 10, 10 ) ) );
+        check_damage( right, rectangle<point>( point( 30, 0 ), point( 40, 10 ) ) );
+    }
+
+    SECTION( "changing the contents of a ui with partial redraw" ) {
+        lower.enable_partial_redraw();
+        lower.invalidate_ui();
+        CHECK( lower.contents_invalidated() );
+        CHECK_FALSE( lower.damaged_region() );
+        check_damage( left, rectangle<point>( point_zero, point( 10, 10 ) ) );
+        check_damage( right, rectangle<point>( point( 30, 0 ), point( 40, 10 ) ) );
+    }
+}
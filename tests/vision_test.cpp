@@ -1,3 +1,7 @@
+#include <array>
+#include <bitset>
+#include <cstdlib>
+#include <cstring>
 #include <functional>
 #include <list>
 #include <memory>
@@ -23,14 +27,17 @@
 #include "options_helpers.h"
 #include "player_helpers.h"
 #include "point.h"
+#include "shadowcasting.h"
 #include "type_id.h"
 #include "units.h"
 #include "vehicle.h"
 #include "vpart_position.h"
 #include "vpart_range.h"
+#include "worker_pool.h"
 
 static const efftype_id effect_narcosis( "narcosis" );
 
+static const field_type_str_id field_fd_fire( "fd_fire" );
 static const field_type_str_id field_fd_smoke( "fd_smoke" );
 
 static const move_mode_id move_mode_crouch( "crouch" );
@@ -1171,3 +1178,77 @@ TEST_CASE( "pl_sees-oob-nocrash", "[vision]" )
 
     clear_avatar();
 }
+
+struct vision_caches {
+    cata::mdarray<float, point_bub_ms> transparency;
+    std::array<std::bitset<MAPSIZE_Y>, MAPSIZE_X> transparent_wo_fields;
+    cata::mdarray<four_quadrants, point_bub_ms> lm;
+    cata::mdarray<float, point_bub_ms> sm;
+    std::array<cata::mdarray<float, point_bub_ms>, OVERMAP_LAYERS> seen;
+};
+
+static std::unique_ptr<vision_caches> rebuild_vision_caches()
+{
+    map &here = get_map();
+    for( int z = -OVERMAP_DEPTH; z <= OVERMAP_HEIGHT; z++ ) {
+        here.set_seen_cache_dirty( z );
+        here.set_transparency_cache_dirty( z );
+    }
+    here.build_map_cache( 0 );
+    std::unique_ptr<vision_caches> ret = std::make_unique<vision_caches>();
+    ret->transparency = here.get_cache_ref( 0 ).transparency_cache;
+    ret->transparent_wo_fields = here.get_cache_ref( 0 ).transparent_cache_wo_fields;
+    ret->lm = here.get_cache_ref( 0 ).lm;
+    ret->sm = here.get_cache_ref( 0 ).sm;
+    for( int z = -OVERMAP_DEPTH; z <= OVERMAP_HEIGHT; z++ ) {
+        ret->seen[z + OVERMAP_DEPTH] = here.get_cache_ref( z ).seen_cache;
+    }
+    return ret;
+}
+
+TEST_CASE( "vision_parallel_matches_serial", "[shadowcasting][vision]" )
+{
+    clear_avatar();
+    clear_map();
+    calendar::turn = midnight;
+    map &here = get_map();
+    const tripoint_bub_ms center = get_player_character().pos_bub();
+
+    // A field of fires between scattered walls gives many buffered light sources
+    for( int x = -20; x <= 20; x++ ) {
+        for( int y = -20; y <= 20; y++ ) {
+            const tripoint_bub_ms p = center + point( x, y );
+            if( p == center ) {
+                continue;
+            }
+            if( ( x * 7 + y * 3 ) % 11 == 0 ) {
+                here.ter_set( p, ter_t_brick_wall );
+            } else if( ( x + y ) % 4 == 0 && std::abs( x ) > 2 ) {
+                here.add_field( p, field_fd_fire, 3 );
+            }
+        }
+    }
+
+    REQUIRE( get_shadowcasting_pool() == nullptr );
+    const std::unique_ptr<vision_caches> serial = rebuild_vision_caches();
+
+    worker_pool pool( 3 );
+    set_shadowcasting_pool( &pool );
+    const on_out_of_scope restore_pool( []() {
+        set_shadowcasting_pool( nullptr );
+    } );
+    const std::unique_ptr<vision_caches> parallel = rebuild_vision_caches();
+
+    CHECK( std::memcmp( &serial->transparency[0][0], &parallel->transparency[0][0],
+                        sizeof( float ) * MAPSIZE_X * MAPSIZE_Y ) == 0 );
+    CHECK( serial->transparent_wo_fields == parallel->transparent_wo_fields );
+    CHECK( std::memcmp( &serial->lm[0][0], &parallel->lm[0][0],
+                        sizeof( four_quadrants ) * MAPSIZE_X * MAPSIZE_Y ) == 0 );
+    CHECK( std::memcmp( &serial->sm[0][0], &parallel->sm[0][0],
+                        sizeof( float ) * MAPSIZE_X * MAPSIZE_Y ) == 0 );
+    for( int z = 0; z < OVERMAP_LAYERS; z++ ) {
+        CAPTURE( z - OVERMAP_DEPTH );
+        CHECK( std::memcmp( &serial->seen[z][0][0], &parallel->seen[z][0][0],
+                            sizeof( float ) * MAPSIZE_X * MAPSIZE_Y ) == 0 );
+    }
+}
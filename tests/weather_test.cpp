@@ -1,6 +1,7 @@
 #include <algorithm>
 #include <cstdlib>
 #include <map>
+#include <tuple>
 #include <vector>
 
 #include "calendar.h"
@@ -471,3 +472,87 @@ TEST_CASE( "local_wind_chill_calculation", "[weather][wind_chill]" )
     }
 }
 
+
+TEST_CASE( "weather_noise_memo_matches_fresh_evaluation", "[weather]" )
+{
+    const weather_generator &wgen = get_weather().get_cur_weather_gen();
+    const unsigned seed = seeds[0];
+    const time_point start = calendar::turn_zero + 100_days;
+    weather_noise_memo &memo = get_weather_noise_memo();
+    on_out_of_scope restore_memo( []() {
+        weather_noise_memo::set_enabled( true );
+    } );
+
+    const auto sample = [&]( const tripoint_abs_ms & where, const time_point & when ) {
+        const w_point w = wgen.get_weather( where, when, seed );
+        return std::make_tuple( units::to_kelvin( w.temperature ), w.humidity, w.pressure );
+    };
+    const auto fresh = [&]( const tripoint_abs_ms & where, const time_point & when ) {
+        weather_noise_memo::set_enabled( false );
+        const auto result = sample( where, when );
+        weather_noise_memo::set_enabled( true );
+        return result;
+    };
+
+    for( int i = 0; i < 20; ++i ) {
+        const tripoint_abs_ms corner( i * 24 * 7, i * 24 * -3, 0 );
+        const time_point hour = start + i * 5_hours;
+        CAPTURE( i );
+        // Exact at the corner of an overmap terrain at the start of an hour
+        CHECK( sample( corner, hour ) == fresh( corner, hour ) );
+
+        // Interpolated elsewhere, close to the exact noise
+        const tripoint_abs_ms inside = corner + tripoint( 13, 17, 0 );
+        const time_point later = hour + 37_minutes;
+        const auto memoized = sample( inside, later );
+        const auto exact = fresh( inside, later );
+        CHECK( std::get<0>( memoized ) == Approx( std::get<0>( exact ) ).margin( 0.5 ) );
+        CHECK( std::get<1>( memoized ) == Approx( std::get<1>( exact ) ).margin( 5 ) );
+        CHECK( std::get<2>( memoized ) == Approx( std::get<2>( exact ) ).margin( 2 ) );
+    }
+
+    SECTION( "one sample per overmap terrain and hour" ) {
+        memo.clear();
+        memo.reset_counters();
+        const tripoint corner( 24 * 5, 24 * 9, 0 );
+        for( int x = 0; x < 24; ++x ) {
+            wgen.get_weather_temperature( corner + tripoint( x, x / 2, 0 ), start, seed );
+        }
+        CHECK( memo.get_counters().misses == 1 );
+        CHECK( memo.get_counters().hits == 23 );
+        // Between two hours both are sampled
+        wgen.get_weather_temperature( corner, start + 30_minutes, seed );
+        CHECK( memo.get_counters().misses == 2 );
+        CHECK( memo.get_counters().hits == 24 );
+    }
+}
+
+TEST_CASE( "weather_temperature_benchmark", "[.][weather][benchmark]" )
+{
+    const weather_generator &wgen = get_weather().get_cur_weather_gen();
+    const unsigned seed = seeds[0];
+    const time_point start = calendar::turn_zero + 100_days;
+    // Items spread over the reality bubble, processed for the two days they were left alone
+    const auto process = [&]() {
+        double total = 0;
+        for( int x = 0; x < 132; x += 11 ) {
+            for( int y = 0; y < 132; y += 11 ) {
+                for( time_point t = start; t < start + 2_days; t += 1_hours ) {
+                    const tripoint where( x, y, 0 );
+                    total += units::to_kelvin( wgen.get_weather_temperature( where, t, seed ) );
+                }
+            }
+        }
+        return total;
+    };
+
+    BENCHMARK( "without memo" ) {
+        weather_noise_memo::set_enabled( false );
+        const double total = process();
+        weather_noise_memo::set_enabled( true );
+        return total;
+    };
+    BENCHMARK( "with memo" ) {
+        return process();
+    };
+}
@@ -0,0 +1,192 @@
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "cata_catch.h"
+#include "debug.h"
+#include "point.h"
+#include "rng.h"
+#include "worker_pool.h"
+
+TEST_CASE( "worker_pool_runs_every_task_once", "[worker_pool]" )
+{
+    const int threads = GENERATE( 0, 1, 3 );
+    worker_pool pool( threads );
+    REQUIRE( pool.size() == threads + 1 );
+
+    for( int tasks : {
+             0, 1, 2, 100
+         } ) {
+        CAPTURE( threads, tasks );
+        std::vector<std::atomic<int>> runs( tasks );
+        std::atomic<int> bad_worker{ 0 };
+        pool.run( tasks, [&]( int task, int worker ) {
+            runs[task]++;
+            if( worker < 0 || worker >= pool.size() ) {
+                bad_worker++;
+            }
+        } );
+        for( const std::atomic<int> &r : runs ) {
+            CHECK( r == 1 );
+        }
+        CHECK( bad_worker == 0 );
+    }
+}
+
+TEST_CASE( "worker_pool_nested_runs_stay_on_the_calling_thread", "[worker_pool]" )
+{
+    worker_pool pool( 2 );
+    std::atomic<int> inner_runs{ 0 };
+    std::atomic<int> inner_bad_worker{ 0 };
+    pool.run( 4, [&]( int, int ) {
+        pool.run( 3, [&]( int, int worker ) {
+            inner_runs++;
+            if( worker != 0 ) {
+                inner_bad_worker++;
+            }
+        } );
+    } );
+    CHECK( inner_runs == 12 );
+    CHECK( inner_bad_worker == 0 );
+}
+
+TEST_CASE( "worker_pool_steals_tasks_from_busy_workers", "[worker_pool]" )
+{
+    worker_pool pool( 3 );
+    // The first quarter of the tasks, worker 0's own range, is much slower than the rest, so the
+    // other workers run out of work and have to take tasks from worker 0
+    const int tasks = 40;
+    std::vector<std::atomic<int>> ran_on( tasks );
+    pool.run( tasks, [&]( int task, int worker ) {
+        if( task < tasks / 4 ) {
+            std::this_thread::sleep_for( std::chrono::milliseconds( 5 ) );
+        }
+        ran_on[task] = worker;
+    } );
+    int stolen = 0;
+    for( int task = 0; task < tasks / 4; task++ ) {
+        if( ran_on[task] != 0 ) {
+            stolen++;
+        }
+    }
+    CHECK( stolen > 0 );
+}
+
+TEST_CASE( "worker_pool_parallel_for_visits_every_point_once", "[worker_pool]" )
+{
+    worker_pool pool( 3 );
+    const point size( 11, 7 );
+    std::vector<std::atomic<int>> visits( size.x * size.y );
+    std::atomic<int> out_of_bounds{ 0 };
+    pool.parallel_for( size, [&]( const point & p, int ) {
+        if( p.x < 0 || p.x >= size.x || p.y < 0 || p.y >= size.y ) {
+            out_of_bounds++;
+            return;
+        }
+        visits[p.y * size.x + p.x]++;
+    } );
+    CHECK( out_of_bounds == 0 );
+    for( const std::atomic<int> &v : visits ) {
+        CHECK( v == 1 );
+    }
+}
+
+TEST_CASE( "worker_pool_set_serial_runs_everything_on_the_caller", "[worker_pool]" )
+{
+    worker_pool pool( 3 );
+    worker_pool::set_serial( true );
+    std::vector<int> order;
+    pool.run( 20, [&]( int task, int worker ) {
+        CHECK( worker == 0 );
+        order.push_back( task );
+    } );
+    worker_pool::set_serial( false );
+    REQUIRE( order.size() == 20 );
+    for( int task = 0; task < 20; task++ ) {
+        CHECK( order[task] == task );
+    }
+}
+
+TEST_CASE( "worker_pool_seeded_tasks_are_deterministic", "[worker_pool][rng]" )
+{
+    const int tasks = 50;
+    const auto draw = [&]( worker_pool & pool ) {
+        std::vector<std::vector<int>> rolls( tasks );
+        pool.run_seeded( tasks, rng_stream( 1234 ), [&]( int task, int ) {
+            for( int i = 0; i < 20; i++ ) {
+                rolls[task].push_back( rng( 0, 1000000 ) );
+            }
+        } );
+        return rolls;
+    };
+    worker_pool parallel( 3 );
+    worker_pool serial( 0 );
+    const std::vector<std::vector<int>> parallel_rolls = draw( parallel );
+    const std::vector<std::vector<int>> serial_rolls = draw( serial );
+    CHECK( parallel_rolls == serial_rolls );
+    CHECK( parallel_rolls[0] != parallel_rolls[1] );
+    // The streams don't disturb the caller's own random numbers
+    rng_set_engine_seed( 42 );
+    const int expected = rng( 0, 1000000 );
+    rng_set_engine_seed( 42 );
+    draw( parallel );
+    CHECK( rng( 0, 1000000 ) == expected );
+}
+
+TEST_CASE( "task_graph_respects_dependencies", "[worker_pool]" )
+{
+    worker_pool pool( 3 );
+    std::mutex mutex;
+    std::vector<std::string> order;
+    const auto step = [&]( const std::string & name ) {
+        return [&order, &mutex, name]( int ) {
+            std::lock_guard<std::mutex> lock( mutex );
+            order.emplace_back( name );
+        };
+    };
+    // a forks into b1..b3, which join into c
+    task_graph graph;
+    const task_graph::task_id c = graph.add( step( "c" ) );
+    const task_graph::task_id a = graph.add( step( "a" ) );
+    for( const char *name : {
+             "b1", "b2", "b3"
+         } ) {
+        const task_graph::task_id b = graph.add( step( name ) );
+        graph.depends( b, a );
+        graph.depends( c, b );
+    }
+    REQUIRE( graph.run( pool ) );
+    REQUIRE( order.size() == 5 );
+    CHECK( order.front() == "a" );
+    CHECK( order.back() == "c" );
+
+    // Running a graph again starts from scratch
+    order.clear();
+    REQUIRE( graph.run( pool ) );
+    CHECK( order.size() == 5 );
+}
+
+TEST_CASE( "task_graph_rejects_cycles", "[worker_pool]" )
+{
+    worker_pool pool( 1 );
+    std::atomic<int> runs{ 0 };
+    task_graph graph;
+    const task_graph::task_id a = graph.add( [&]( int ) {
+        runs++;
+    } );
+    const task_graph::task_id b = graph.add( [&]( int ) {
+        runs++;
+    } );
+    graph.depends( a, b );
+    graph.depends( b, a );
+    bool ran = true;
+    const std::string msg = capture_debugmsg_during( [&]() {
+        ran = graph.run( pool );
+    } );
+    CHECK_FALSE( ran );
+    CHECK( runs == 0 );
+    CHECK_THAT( msg, Catch::EndsWith( "task_graph has a dependency cycle" ) );
+}